@@ -14,5 +14,9 @@ void DRV8833_init(void );
 void set_PWM_duty_cycle(motor_t motor, uint32_t duty_cycle);
 error_codes_te  DRV8833_set_motor(motor_t motor_number, motor_cmd_t cmd, int8_t pwm_width);
 void set_vehicle_state(void);
+void DRV8833_brake_all(void);
+void motor_watchdog_init(void);
+void motor_watchdog_feed(motor_t motor_number, motor_cmd_t cmd, int8_t pwm_width);
+void motor_watchdog_get_data(struct motor_watchdog_data_s *data_pt);
 
 #endif
\ No newline at end of file
@@ -128,6 +128,27 @@
 #define DISABLE_CHARGE_PUMP     0x10
 #define ENABLE_CHARGE_PUMP      0x14
 
+#define SET_COLUMN_ADDRESS      0x21    // horizontal/vertical mode : start, end
+#define SET_PAGE_ADDRESS        0x22    // horizontal/vertical mode : start, end
+
+#define SET_VERTICAL_SCROLL_AREA    0xA3    // rows in top fixed area, rows in scroll area
+
+#define SSD1306_NOP             0xE3
+
+// I2C control byte : Co = 0, D/C selects rest of transaction as commands or RAM data
+
+#define SSD1306_CONTROL_COMMAND_STREAM  0x00
+#define SSD1306_CONTROL_DATA_STREAM     0x40
+
+//==============================================================================
+// Copy of display RAM. Drawing routines write here and mark the area
+// dirty; SSD1306_flush() sends the dirty areas to the display.
+//==============================================================================
+extern uint8_t SSD1306_RAM[];
+
+extern const uint8_t init_sequence[];
+extern const uint32_t init_sequence_length;
+
 
 //==============================================================================
 // Function Prototypes.
@@ -150,10 +171,16 @@
     void Oled_Image(const unsigned char *buffer);
     void Oled_InvertRam(uint8_t seg1, uint8_t pag1, uint8_t seg2, uint8_t pag2);
     void Oled_Icon(const unsigned char *buffer, uint8_t seg, uint8_t pag, uint8_t _width, uint8_t _height);
-    void Oled_Pixel(uint8_t x, uint8_t y, uint8_t color);
-    void Oled_Line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color);
-    void Oled_Rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color);
-    void Oled_Circle(uint8_t x1, uint8_t y1, uint8_t radius, uint8_t color);
+    void Oled_Pixel(int16_t x, int16_t y, uint8_t color);
+    void Oled_HLine(int16_t x1, int16_t x2, int16_t y, uint8_t color);
+    void Oled_VLine(int16_t x, int16_t y1, int16_t y2, uint8_t color);
+    void Oled_Line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+    void Oled_Rectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+    void Oled_FillRectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color);
+    void Oled_Circle(int16_t x1, int16_t y1, int16_t radius, uint8_t color);
+    void Oled_FillCircle(int16_t x1, int16_t y1, int16_t radius, uint8_t color);
+    void Oled_Bitmap(const unsigned char *buffer, int16_t x, int16_t y, uint8_t _width, uint8_t _height);
+    uint32_t Oled_GetPlotCount(void);
     void Right_HorizontalScroll(uint8_t start_page, uint8_t end_page, uint8_t set_time);
     void Left_HorizontalScroll(uint8_t start_page, uint8_t end_page, uint8_t set_time);
     void VerticalRight_HorizontalScroll(uint8_t start_page, uint8_t end_page, uint8_t set_time);
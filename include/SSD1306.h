@@ -2,8 +2,24 @@
 #define __SSD1306_h__
 
 uint8_t SSD1306_write_string(uint8_t font_code, uint8_t pag_window, const uint8_t *buffer, bool invert);
+uint8_t SSD1306_write_cells(uint8_t font_code, uint8_t window, uint8_t first_cell, uint8_t nos_cells, const uint8_t *buffer, bool invert);
+int16_t SSD1306_draw_text(uint8_t font_code, int16_t x, int16_t y, const uint8_t *buffer, uint8_t nos_chars, bool invert);
 void SSD1306_set_window(uint8_t window, uint8_t byte_value);
 void SSD1306_set_text_area_scroller(/* uint8_t first_row, uint8_t nos_rows, */ uint8_t nos_strings, const char **scroll_strings);
-void SSD1306_set_text_area(uint8_t window, uint8_t nos_strings, char *message_strings[]);
+uint8_t SSD1306_set_text_area(uint8_t window, uint8_t nos_strings, char *message_strings[]);
+void SSD1306_dma_init(void);
+void SSD1306_i2c_set_speed(uint32_t baudrate);
+bool SSD1306_i2c_probe(void);
+bool SSD1306_i2c_write(uint8_t control, const uint8_t *data, uint32_t len);
+uint32_t SSD1306_bus_time_us(uint32_t nos_bytes);
+void SSD1306_capture_start(uint8_t *buffer, uint32_t size);
+uint32_t SSD1306_capture_stop(bool *overflow);
+void SSD1306_write_data(const uint8_t *data, uint32_t len);
+void SSD1306_mark_dirty(uint8_t page, uint8_t first_seg, uint8_t last_seg);
+void SSD1306_mark_all_dirty(void);
+void SSD1306_flush(void);
+void SSD1306_reset_stats(void);
+void SSD1306_scroll_area_reset(void);
+void SSD1306_scroll_area_step(void);
 
 #endif
\ No newline at end of file
@@ -12,10 +12,21 @@
 
 void update_task_execution_time(task_t task, uint32_t start_time, uint32_t end_time);
 void log_error(error_codes_te error_code, task_t task);
+void send_motor_cmd(motor_cmd_t cmd, motor_t motor, int8_t pwm_width, uint16_t deadline_ms);
+void emergency_stop(uint32_t request_time_us);
+void emergency_stop_get_data(struct emergency_stop_data_s *data_pt);
 void reset_push_button_timers(void);
 uint32_t wait_for_button_press(uint8_t push_button, uint32_t time_out);
 EventBits_t wait_for_any_button_press(uint32_t time_out_us);
+void LCD_update_begin(void);
+void LCD_update_row(uint8_t font, uint8_t row, const char *row_string, bool invert);
+void LCD_update_scroller(uint8_t nos_strings, const char **scroll_strings);
+void LCD_update_end(void);
 void LCD_write_row(uint8_t font, uint8_t row, const char *row_string, bool invert);
+void LCD_refresh_all_rows(void);
+void LCD_notify_update(void);
+void LCD_set_refresh_class(LCD_class_te refresh_class);
+uint8_t battery_icon(uint16_t battery_volts);
 void set_tune_data(struct note_data_s *notes, uint16_t nos_notes, bool enable, uint32_t repeat_count);
 void tune_off(void);
 void tune_on(void);
@@ -28,6 +39,7 @@ void reset_USB(void);
 error_codes_te null_function(uint8_t mode_index, uint32_t parameter);
 void prime_free_buffer_queue(void);
 void print_string(char *string_pt);
+void print_bytes(const uint8_t *data, uint32_t length);
 
 
 #endif
\ No newline at end of file
@@ -0,0 +1,86 @@
+/**
+ * @file    drive_model.h
+ * @author  Jim Herd
+ * @brief   Integer model of the differential drive
+ *
+ * @note
+ * No Pico SDK or FreeRTOS dependencies, so that the model can be built
+ * and checked on a host (see tools/host_tests).
+ */
+
+#ifndef __DRIVE_MODEL_H__
+#define __DRIVE_MODEL_H__
+
+#include    <stdint.h>
+#include    <stdbool.h>
+
+//==============================================================================
+// Motor watchdog
+//
+// Runs from a Pico repeating timer interrupt, independent of FreeRTOS tasks.
+// If a motor is running and no valid command has been applied for
+// MOTOR_WATCHDOG_TIMEOUT_MS, both motors are braked.
+// Worst case reaction time is TIMEOUT + CHECK period.
+
+#define     MOTOR_WATCHDOG_TIMEOUT_MS       250
+#define     MOTOR_WATCHDOG_CHECK_MS         5
+
+//==============================================================================
+// Odometry
+//
+// Wheel speed is estimated from the PWM width : no movement inside the
+// motor deadband, then linear up to the speed measured at 100% PWM.
+// Values to be defined by experimentation.
+
+#define     WHEEL_TRACK_MM                  120     // distance between wheel centres
+#define     WHEEL_SPEED_AT_FULL_PWM_MM_S    300     // wheel speed at 100% PWM
+#define     MOTOR_DEADBAND_PERCENT          20      // PWM % below which wheel does not turn
+
+// Odometry is integrated by the sensor task, so shares its fixed rate
+// (checked in system.h).  Per-tick constants are folded at compile time.
+
+#define     ODOMETRY_FREQUENCY              50      // Hz
+#define     ODOMETRY_UM_PER_MM_S            (1000 / ODOMETRY_FREQUENCY)     // distance (uM) per tick at 1mm/S
+#define     ODOMETRY_HEADING_PER_MM_S       ((int32_t)(4294967296.0 / (2.0 * 3.14159265358979 * WHEEL_TRACK_MM * ODOMETRY_FREQUENCY)))
+
+#define     BAM_TO_DEGREES(bam)             ((int16_t)(((uint32_t)(bam) * 360) >> 16))
+#define     DEGREES_TO_BAM(degrees)         ((int32_t)(degrees) * 65536 / 360)
+
+//==============================================================================
+// Motion primitive speed profile
+//
+// Trapezoid : ramp up from the start speed at a fixed rate, then slow down
+// in proportion to the distance left.  Run by the motion task at
+// MOTION_FREQUENCY (checked in system.h).
+
+#define     MOTION_FREQUENCY                50      // Hz
+#define     MOTION_MIN_SPEED_MM_S           30      // start/finish speed
+#define     MOTION_ACCEL_MM_S_PER_TICK      12      // ramp up : 600mm/S/S at 50Hz
+#define     MOTION_SLOWDOWN_GAIN            5       // ramp down : mm/S per mm remaining
+#define     MOTION_TIMEOUT_FACTOR           3       // abort if primitive takes 3x expected time
+
+//==============================================================================
+// Vehicle pose
+//
+//      position    int32_t  units of uM   (+/- 2km)
+//      heading     uint32_t binary angle  (2^32 = 360 degrees, wraps naturally)
+
+struct pose_s {
+    int32_t     x_um, y_um;
+    uint32_t    heading;
+    uint32_t    distance_mm;        // total path length of vehicle centre
+    uint32_t    distance_um;        // fraction of a mm
+} ;
+
+//==============================================================================
+// Function prototypes
+
+int16_t  wheel_speed_mm_s(int8_t pwm_width);
+int8_t   wheel_pwm_for_speed(int16_t speed_mm_s);
+int16_t  odometry_sin(uint16_t angle);
+int16_t  odometry_cos(uint16_t angle);
+void     odometry_step(struct pose_s *pose, int16_t left_speed, int16_t right_speed);
+int32_t  motion_profile_speed(int32_t speed, int32_t max_speed, int32_t remaining_mm);
+bool     motor_watchdog_expired(bool running, uint32_t silence_us);
+
+#endif  /* __DRIVE_MODEL_H__ */
@@ -19,6 +19,11 @@ typedef enum  {
     USB_CONTROLLER_NOT_CONNECTED    = -5,
     GAMEPAD_ERROR_READING_VID_PID   = -6,
     GLITCH_ERRORS_ON_AD_READ        = -7,
+    MOTION_PRIMITIVE_TIMEOUT        = -8,
+    SSD1306_I2C_TIMEOUT             = -9,
+    SSD1306_I2C_ABORT               = -10,
+    SSD1306_I2C_SPEED_FALLBACK      = -11,
+    TELEMETRY_RECORD_TOO_LONG       = -12,
 } error_codes_te;
 
 //==============================================================================
@@ -19,13 +19,27 @@
 #include <stdlib.h>
 #include "system.h"
 
+//
+// Fonts used by SSD1306_write_string() are the page-major copies generated
+// from the fonts below by tools/font_page_major.py (see font_page_major.h)
+//
 const uint8_t *font_table[] = {
-    Terminal_9x16,                  // font 0
-    robokid_LCD_icons_font_15x16,   // font 1
+    Terminal_9x16_page_major,                   // font 0
+    robokid_LCD_icons_font_15x16_page_major,    // font 1
+    Terminal_12x16_page_major,                  // font 2
+    Font_6x8_page_major,                        // font 3
+    Segment_25x40_page_major,                   // font 4
+};
+
+#define FONT_METRICS(name, width, height, first, last)  \
+    {width, height, (height / 8), first, last, (width * (height / 8)), &name[4]}
 
-    // &Terminal_12x16[0],          // font 2
-    // &Font_6x8[0],                // font 3
-    // &Segment_25x40[0],           // font 4
+const struct font_metrics_s font_metrics[NOS_FONTS] = {
+    FONT_METRICS(Terminal_9x16_page_major,                TERMINAL_9x16_FONT_WIDTH,           TERMINAL_9x16_FONT_HEIGHT,           32, 126),
+    FONT_METRICS(robokid_LCD_icons_font_15x16_page_major, ROBOKID_LCD_ICONS_FONT_15x16_WIDTH, ROBOKID_LCD_ICONS_FONT_15x16_HEIGHT, 32, 126),
+    FONT_METRICS(Terminal_12x16_page_major,               TERMINAL_12x16_FONT_WIDTH,          TERMINAL_12x16_FONT_HEIGHT,          32, 127),
+    FONT_METRICS(Font_6x8_page_major,                     FONT_6x8_WIDTH,                     FONT_6x8_HEIGHT,                     32, 127),
+    FONT_METRICS(Segment_25x40_page_major,                SEGMENT_25x40_FONT_WIDTH,           SEGMENT_25x40_FONT_HEIGHT,           46,  58),
 };
 
 const unsigned char Terminal_9x16[] = {
@@ -459,4 +473,6 @@ const unsigned char Segment_25x40[] = {
 //GLCD FontName : robokid_LCD_icons_font15x16
 //GLCD FontSize : 15 x 16
 
+#include "font_page_major.h"
+
 #endif  /* FONT_H */
\ No newline at end of file
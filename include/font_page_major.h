@@ -0,0 +1,764 @@
+/**
+ * @file    font_page_major.h
+ * @brief   Page-major copies of fonts in font.h
+ *
+ * GENERATED by tools/font_page_major.py : do not edit
+ */
+
+#ifndef __FONT_PAGE_MAJOR_H__
+#define __FONT_PAGE_MAJOR_H__
+
+const unsigned char Terminal_9x16_page_major[] = {
+9, 16, 32, 126,        // header
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 32
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7C, 0xFE, 0xFE, 0x7C, 0x00, 0x00,  // char 33
+0x00, 0x00, 0x00, 0x00, 0x67, 0x67, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00, 0x0E, 0x0E, 0x00,  // char 34
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x40, 0xFC, 0xFC, 0x40, 0x40, 0xFC, 0xFC, 0x40,  // char 35
+0x00, 0x02, 0x3F, 0x3F, 0x02, 0x02, 0x3F, 0x3F, 0x02,
+0x00, 0x70, 0x78, 0xC8, 0xFE, 0xFE, 0x08, 0x38, 0x30,  // char 36
+0x00, 0x0C, 0x1C, 0x10, 0x7F, 0x7F, 0x13, 0x1E, 0x0E,
+0x00, 0x3C, 0x66, 0x3C, 0x80, 0xE0, 0x38, 0x0E, 0x02,  // char 37
+0x00, 0x60, 0x38, 0x0E, 0x03, 0x00, 0x3C, 0x66, 0x3C,
+0x00, 0x3C, 0x66, 0xC2, 0xC2, 0x66, 0x3C, 0x00, 0x00,  // char 38
+0x00, 0x3E, 0x63, 0x41, 0x41, 0x63, 0x3E, 0x36, 0x63,
+0x00, 0x00, 0x00, 0x00, 0x16, 0x0E, 0x00, 0x00, 0x00,  // char 39
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xF0, 0xFC, 0x0E, 0x00, 0x00, 0x00,  // char 40
+0x00, 0x00, 0x00, 0x0F, 0x3F, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFC, 0xF0, 0x00, 0x00,  // char 41
+0x00, 0x00, 0x00, 0x00, 0x70, 0x3F, 0x0F, 0x00, 0x00,
+0x00, 0x00, 0x40, 0xC0, 0x80, 0x80, 0xC0, 0x40, 0x00,  // char 42
+0x00, 0x01, 0x05, 0x07, 0x03, 0x03, 0x07, 0x05, 0x01,
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00,  // char 43
+0x00, 0x01, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 44
+0x00, 0x00, 0x00, 0x00, 0x30, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 45
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 46
+0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x78, 0x1E, 0x06,  // char 47
+0x00, 0x60, 0x78, 0x1E, 0x07, 0x01, 0x00, 0x00, 0x00,
+0x00, 0xF8, 0xFC, 0x06, 0x02, 0xC2, 0x36, 0xFC, 0xF8,  // char 48
+0x00, 0x1F, 0x3F, 0x6C, 0x43, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0x08, 0x08, 0x0C, 0xFE, 0xFE, 0x00, 0x00, 0x00,  // char 49
+0x00, 0x40, 0x40, 0x40, 0x7F, 0x7F, 0x40, 0x40, 0x40,
+0x00, 0x18, 0x1C, 0x06, 0x02, 0x02, 0x86, 0xFC, 0x78,  // char 50
+0x00, 0x70, 0x78, 0x4C, 0x46, 0x43, 0x41, 0x40, 0x40,
+0x00, 0x18, 0x1C, 0x86, 0x82, 0x82, 0x86, 0xFC, 0x78,  // char 51
+0x00, 0x18, 0x38, 0x60, 0x40, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0x00, 0x00, 0xC0, 0xF8, 0x3E, 0x06, 0x00, 0x00,  // char 52
+0x00, 0x00, 0x1E, 0x1F, 0x11, 0x10, 0x7F, 0x7F, 0x10,
+0x00, 0x7E, 0x7E, 0x42, 0x42, 0x42, 0xC2, 0x82, 0x02,  // char 53
+0x00, 0x18, 0x38, 0x60, 0x40, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0xC0, 0xF0, 0xB8, 0x8C, 0x86, 0x82, 0x02, 0x02,  // char 54
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x61, 0x3F, 0x1E,
+0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0xE2, 0xFE, 0x1E,  // char 55
+0x00, 0x00, 0x00, 0x00, 0x78, 0x7F, 0x07, 0x00, 0x00,
+0x00, 0x38, 0x7C, 0xC6, 0x82, 0x82, 0xC6, 0x7C, 0x38,  // char 56
+0x00, 0x1E, 0x3F, 0x61, 0x40, 0x40, 0x61, 0x3F, 0x1E,
+0x00, 0x78, 0xFC, 0x86, 0x02, 0x02, 0x06, 0xFC, 0xF8,  // char 57
+0x00, 0x40, 0x40, 0x41, 0x61, 0x31, 0x1D, 0x0F, 0x03,
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00,  // char 58
+0x00, 0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00,  // char 59
+0x00, 0x00, 0x00, 0x00, 0x30, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x08, 0x00,  // char 60
+0x00, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x20, 0x00,
+0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,  // char 61
+0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+0x00, 0x08, 0x18, 0x30, 0x60, 0xC0, 0x80, 0x00, 0x00,  // char 62
+0x00, 0x20, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00,
+0x00, 0x0C, 0x0E, 0x06, 0x02, 0x82, 0xE6, 0x7E, 0x3C,  // char 63
+0x00, 0x00, 0x00, 0x00, 0x66, 0x67, 0x01, 0x00, 0x00,
+0x00, 0x00, 0xF8, 0x0C, 0x04, 0xC4, 0x44, 0x4C, 0xF8,  // char 64
+0x00, 0x00, 0x3F, 0x60, 0x40, 0x47, 0x44, 0x62, 0x27,
+0x00, 0xF8, 0xFC, 0x06, 0x02, 0x02, 0x06, 0xFC, 0xF8,  // char 65
+0x00, 0x7F, 0x7F, 0x02, 0x02, 0x02, 0x02, 0x7F, 0x7F,
+0x00, 0xFE, 0xFE, 0x82, 0x82, 0x82, 0xC6, 0x7C, 0x38,  // char 66
+0x00, 0x7F, 0x7F, 0x40, 0x40, 0x40, 0x61, 0x3F, 0x1E,
+0x00, 0xF8, 0xFC, 0x06, 0x02, 0x02, 0x06, 0x1C, 0x18,  // char 67
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x60, 0x38, 0x18,
+0x00, 0xFE, 0xFE, 0x02, 0x02, 0x02, 0x0E, 0xFC, 0xF0,  // char 68
+0x00, 0x7F, 0x7F, 0x40, 0x40, 0x40, 0x70, 0x3F, 0x0F,
+0x00, 0xFE, 0xFE, 0x82, 0x82, 0x82, 0x82, 0x82, 0x02,  // char 69
+0x00, 0x7F, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x00, 0xFE, 0xFE, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,  // char 70
+0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x00, 0xF8, 0xFC, 0x06, 0x02, 0x02, 0x06, 0x1C, 0x18,  // char 71
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x41, 0x61, 0x3F, 0x1F,
+0x00, 0xFE, 0xFE, 0x80, 0x80, 0x80, 0x80, 0xFE, 0xFE,  // char 72
+0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+0x00, 0x02, 0x02, 0x02, 0xFE, 0xFE, 0x02, 0x02, 0x02,  // char 73
+0x00, 0x40, 0x40, 0x40, 0x7F, 0x7F, 0x40, 0x40, 0x40,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE,  // char 74
+0x00, 0x18, 0x38, 0x60, 0x40, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0xFE, 0xFE, 0x80, 0xC0, 0x70, 0x38, 0x1E, 0x06,  // char 75
+0x00, 0x7F, 0x7F, 0x01, 0x03, 0x0E, 0x1C, 0x78, 0x60,
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 76
+0x00, 0x7F, 0x7F, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40,
+0x00, 0xFE, 0xFE, 0xF0, 0x80, 0x80, 0xF0, 0xFE, 0xFE,  // char 77
+0x00, 0x7F, 0x7F, 0x00, 0x07, 0x07, 0x00, 0x7F, 0x7F,
+0x00, 0xFE, 0xFE, 0x38, 0xE0, 0x80, 0x00, 0xFE, 0xFE,  // char 78
+0x00, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0x0E, 0x7F, 0x7F,
+0x00, 0xF8, 0xFC, 0x06, 0x02, 0x02, 0x06, 0xFC, 0xF8,  // char 79
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0xFE, 0xFE, 0x02, 0x02, 0x02, 0x86, 0xFC, 0x78,  // char 80
+0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+0x00, 0xF8, 0xFC, 0x06, 0x02, 0x02, 0x06, 0xFC, 0xF8,  // char 81
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0xC0, 0xE0, 0x3F, 0x1F,
+0x00, 0xFE, 0xFE, 0x02, 0x02, 0x02, 0x86, 0xFC, 0x78,  // char 82
+0x00, 0x7F, 0x7F, 0x01, 0x01, 0x03, 0x3F, 0x7C, 0x40,
+0x00, 0x78, 0xFC, 0xC6, 0xC2, 0x82, 0x06, 0x1C, 0x18,  // char 83
+0x00, 0x18, 0x38, 0x60, 0x41, 0x43, 0x63, 0x3F, 0x1E,
+0x00, 0x02, 0x02, 0x02, 0xFE, 0xFE, 0x02, 0x02, 0x02,  // char 84
+0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00,
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE,  // char 85
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0x7E, 0xFE, 0x80, 0x00, 0x00, 0x80, 0xFE, 0x7E,  // char 86
+0x00, 0x00, 0x03, 0x1F, 0x78, 0x78, 0x1F, 0x03, 0x00,
+0x00, 0xFE, 0xFE, 0x00, 0x80, 0x80, 0x00, 0xFE, 0xFE,  // char 87
+0x00, 0x03, 0x7F, 0x7C, 0x03, 0x03, 0x7C, 0x7F, 0x03,
+0x00, 0x1E, 0x7E, 0xE0, 0x80, 0x80, 0xE0, 0x7E, 0x1E,  // char 88
+0x00, 0x78, 0x7E, 0x07, 0x01, 0x01, 0x07, 0x7E, 0x78,
+0x00, 0x7E, 0xFE, 0x80, 0x00, 0x00, 0x80, 0xFE, 0x7E,  // char 89
+0x00, 0x00, 0x01, 0x03, 0x7F, 0x7F, 0x03, 0x01, 0x00,
+0x00, 0x02, 0x02, 0x02, 0x82, 0xC2, 0x72, 0x3E, 0x0E,  // char 90
+0x00, 0x70, 0x7C, 0x4F, 0x43, 0x40, 0x40, 0x40, 0x40,
+0x00, 0x00, 0x00, 0xFE, 0xFE, 0x02, 0x02, 0x00, 0x00,  // char 91
+0x00, 0x00, 0x00, 0x7F, 0x7F, 0x40, 0x40, 0x00, 0x00,
+0x00, 0x06, 0x1E, 0x78, 0xE0, 0x80, 0x00, 0x00, 0x00,  // char 92
+0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1E, 0x78, 0x60,
+0x00, 0x00, 0x00, 0x02, 0x02, 0xFE, 0xFE, 0x00, 0x00,  // char 93
+0x00, 0x00, 0x00, 0x40, 0x40, 0x7F, 0x7F, 0x00, 0x00,
+0x00, 0x08, 0x08, 0x0C, 0x06, 0x06, 0x0C, 0x0C, 0x08,  // char 94
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 95
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0x16, 0x00, 0x00, 0x00,  // char 96
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0x40, 0x40, 0x40, 0x40, 0xC0, 0x80,  // char 97
+0x00, 0x3C, 0x7E, 0x42, 0x42, 0x42, 0x22, 0x7F, 0x7F,
+0x00, 0xFE, 0xFE, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00,  // char 98
+0x00, 0x7F, 0x7F, 0x20, 0x40, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0x00, 0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80,  // char 99
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x40, 0x60, 0x20,
+0x00, 0x00, 0x80, 0xC0, 0x40, 0x40, 0x80, 0xFE, 0xFE,  // char 100
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x20, 0x7F, 0x7F,
+0x00, 0x00, 0x80, 0xC0, 0x40, 0x40, 0xC0, 0x80, 0x00,  // char 101
+0x00, 0x1F, 0x3F, 0x64, 0x44, 0x44, 0x44, 0x67, 0x27,
+0x00, 0x40, 0x40, 0xFC, 0xFE, 0x42, 0x42, 0x46, 0x04,  // char 102
+0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x80, 0xC0, 0x60, 0x20, 0x20, 0x40, 0xE0, 0xE0,  // char 103
+0x00, 0x07, 0x4F, 0x58, 0x50, 0x50, 0x48, 0x7F, 0x3F,
+0x00, 0xFE, 0xFE, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00,  // char 104
+0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+0x00, 0x00, 0x40, 0x40, 0xC6, 0xC6, 0x00, 0x00, 0x00,  // char 105
+0x00, 0x00, 0x40, 0x40, 0x7F, 0x7F, 0x40, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x10, 0x10, 0xF6, 0xF6, 0x00, 0x00,  // char 106
+0x00, 0x00, 0x20, 0x60, 0x40, 0x7F, 0x3F, 0x00, 0x00,
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x40,  // char 107
+0x00, 0x7F, 0x7F, 0x0C, 0x0E, 0x1B, 0x31, 0x60, 0x40,
+0x00, 0x00, 0x02, 0x02, 0xFE, 0xFE, 0x00, 0x00, 0x00,  // char 108
+0x00, 0x00, 0x40, 0x40, 0x7F, 0x7F, 0x40, 0x40, 0x00,
+0x00, 0xC0, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0xC0, 0x80,  // char 109
+0x00, 0x7F, 0x7F, 0x00, 0x3F, 0x3F, 0x00, 0x7F, 0x7F,
+0x00, 0xC0, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00,  // char 110
+0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F,
+0x00, 0x00, 0x80, 0xC0, 0x40, 0x40, 0xC0, 0x80, 0x00,  // char 111
+0x00, 0x1F, 0x3F, 0x60, 0x40, 0x40, 0x60, 0x3F, 0x1F,
+0x00, 0xF0, 0xF0, 0x20, 0x10, 0x10, 0x30, 0xE0, 0xC0,  // char 112
+0x00, 0x7F, 0x7F, 0x08, 0x10, 0x10, 0x18, 0x0F, 0x07,
+0x00, 0xC0, 0xE0, 0x10, 0x10, 0x10, 0x20, 0xF0, 0xF0,  // char 113
+0x00, 0x07, 0x0F, 0x10, 0x10, 0x10, 0x08, 0x7F, 0x7F,
+0x00, 0xC0, 0xC0, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0x80,  // char 114
+0x00, 0x7F, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x80, 0xC0, 0x40, 0x40, 0x40, 0x40, 0xC0, 0x80,  // char 115
+0x00, 0x21, 0x63, 0x42, 0x46, 0x4C, 0x48, 0x78, 0x30,
+0x00, 0x00, 0x40, 0x40, 0xFC, 0xFC, 0x40, 0x40, 0x00,  // char 116
+0x00, 0x00, 0x00, 0x00, 0x3F, 0x7F, 0x40, 0x40, 0x00,
+0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0,  // char 117
+0x00, 0x3F, 0x7F, 0x40, 0x40, 0x40, 0x20, 0x7F, 0x7F,
+0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0,  // char 118
+0x00, 0x07, 0x0F, 0x38, 0x60, 0x60, 0x38, 0x0F, 0x07,
+0x00, 0xC0, 0xC0, 0x00, 0x80, 0x80, 0x00, 0xC0, 0xC0,  // char 119
+0x00, 0x0F, 0x7F, 0x70, 0x0F, 0x0F, 0x70, 0x7F, 0x0F,
+0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0,  // char 120
+0x00, 0x60, 0x7B, 0x1B, 0x0E, 0x0E, 0x1B, 0x7B, 0x60,
+0x00, 0xF0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xF0,  // char 121
+0x00, 0x01, 0x47, 0x6E, 0x38, 0x18, 0x0E, 0x07, 0x01,
+0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xC0, 0xC0,  // char 122
+0x00, 0x60, 0x70, 0x58, 0x4C, 0x46, 0x43, 0x41, 0x40,
+0x00, 0x00, 0x00, 0x00, 0xF8, 0xFC, 0x04, 0x04, 0x00,  // char 123
+0x00, 0x00, 0x00, 0x01, 0x3F, 0x7E, 0x40, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xFC, 0xFC, 0x00, 0x00, 0x00,  // char 124
+0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0x04, 0xFC, 0xF8, 0x00, 0x00, 0x00,  // char 125
+0x00, 0x00, 0x40, 0x40, 0x7E, 0x3F, 0x01, 0x00, 0x00,
+0x00, 0x04, 0x04, 0x02, 0x02, 0x04, 0x04, 0x02, 0x02,  // char 126
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const unsigned char robokid_LCD_icons_font_15x16_page_major[] = {
+15, 16, 32, 126,        // header
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 32
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xF0, 0xF0, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xF0, 0xF0, 0x00, 0x00, 0x00,  // char 33
+0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xF0, 0x90, 0x9C, 0x9C, 0x9C, 0x9C, 0x9C, 0x90, 0xF0, 0x00, 0x00, 0x00,  // char 34
+0x00, 0x00, 0x00, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xF0, 0x10, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x10, 0xF0, 0x00, 0x00, 0x00,  // char 35
+0x00, 0x00, 0x00, 0x3F, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xF0, 0x10, 0x1C, 0x1C, 0x1C, 0x1C, 0x1C, 0x10, 0xF0, 0x00, 0x00, 0x00,  // char 36
+0x00, 0x00, 0x00, 0x3F, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xF0, 0x10, 0x1C, 0x1C, 0xDC, 0x1C, 0x1C, 0x10, 0xF0, 0x00, 0x00, 0x00,  // char 37
+0x00, 0x00, 0x00, 0x3F, 0x20, 0x20, 0x20, 0x2B, 0x20, 0x20, 0x20, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x20, 0x30, 0x38, 0xFC, 0xFE, 0xFC, 0x38, 0x30, 0x20, 0x00, 0x00, 0x00,  // char 38
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 39
+0x00, 0x00, 0x00, 0x04, 0x0C, 0x1C, 0x3F, 0x7F, 0x3F, 0x1C, 0x0C, 0x04, 0x00, 0x00, 0x00,
+0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00,  // char 40
+0x00, 0x00, 0x01, 0x03, 0x07, 0x0F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xF8, 0xF0, 0xE0, 0xC0, 0x80, 0x00,  // char 41
+0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x0F, 0x07, 0x03, 0x01, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 42
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 43
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 44
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 45
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 46
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x26, 0x49, 0x49, 0x32, 0x00, 0x38, 0x54, 0x54, 0x18, 0x00, 0x7F, 0x00, 0x00,  // char 47
+0x00, 0x00, 0x00, 0x26, 0x49, 0x49, 0x32, 0x00, 0x04, 0x3E, 0x44, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x26, 0x49, 0x49, 0x32, 0x00, 0x38, 0x54, 0x54, 0x18, 0x00, 0x7F, 0x00, 0x00,  // char 48
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 49
+0x00, 0x00, 0x00, 0x26, 0x49, 0x49, 0x32, 0x00, 0x04, 0x3E, 0x44, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0x28, 0x24, 0x28, 0xF0, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,  // char 50
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x3F, 0x24, 0x24, 0x1B, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0x28, 0x24, 0x28, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 51
+0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,  // char 52
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x24, 0x24, 0x1B, 0x00, 0x00,
+0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 53
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x38, 0x04, 0x03, 0x00, 0x00,
+0x00, 0x00, 0x44, 0x28, 0x10, 0x28, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 54
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 55
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x04, 0x38, 0x04, 0x03, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFC, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 56
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x12, 0x32, 0x4C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xFC, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 57
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 58
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x12, 0x32, 0x4C, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0xC0, 0x80, 0x08, 0x0C, 0xFE, 0x0C, 0x08, 0xE0, 0xE0, 0xE0, 0x00, 0x00,  // char 59
+0x00, 0x01, 0x01, 0x03, 0x05, 0x05, 0x64, 0x7F, 0x62, 0x02, 0x02, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x84, 0xC8, 0x90, 0x28, 0x4C, 0xFE, 0xCC, 0x28, 0xF0, 0xE8, 0xE4, 0x02, 0x00,  // char 60
+0x00, 0x21, 0x11, 0x0B, 0x05, 0x07, 0x65, 0x7F, 0x63, 0x02, 0x06, 0x09, 0x10, 0x20, 0x00,
+0x00, 0xC0, 0x60, 0x60, 0x60, 0x40, 0x40, 0x70, 0x48, 0x44, 0x64, 0x62, 0x60, 0xC0, 0x00,  // char 61
+0x00, 0x1F, 0x20, 0x22, 0x17, 0x12, 0x10, 0x10, 0x14, 0x11, 0x14, 0x21, 0x20, 0x1F, 0x00,
+0x00, 0xE4, 0x38, 0x30, 0xB0, 0x60, 0xA0, 0x3C, 0xA4, 0xE2, 0x32, 0xB0, 0x38, 0xE4, 0x00,  // char 62
+0x00, 0x4F, 0x30, 0x11, 0x0B, 0x0D, 0x0A, 0x09, 0x0A, 0x0C, 0x0A, 0x10, 0x30, 0x4F, 0x00,
+0xFF, 0xFF, 0xFF, 0x03, 0x03, 0x73, 0x73, 0x73, 0xF3, 0xFF, 0xFF, 0x01, 0x01, 0xFF, 0xFF,  // char 63
+0xFF, 0xFF, 0xFF, 0xC0, 0xC0, 0xCE, 0xCE, 0xCE, 0xCF, 0xFF, 0xFF, 0xC8, 0xC8, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 64
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 65
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 66
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 67
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 68
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 69
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 70
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 71
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 72
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 73
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 74
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 75
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 76
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 77
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 78
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 79
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 80
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 81
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 82
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 83
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 84
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 85
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 86
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 87
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 88
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 89
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 90
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 91
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 92
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 93
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 94
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 95
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 96
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 97
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 98
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 99
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 100
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 101
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 102
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 103
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 104
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 105
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 106
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 107
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 108
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 109
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 110
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 111
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 112
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 113
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 114
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 115
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 116
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 117
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 118
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 119
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 120
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 121
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 122
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 123
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 124
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 125
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 126
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const unsigned char Terminal_12x16_page_major[] = {
+12, 16, 32, 127,        // header
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 32
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xF8, 0xFE, 0xFE, 0xF8, 0x00, 0x00, 0x00, 0x00,  // char 33
+0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x3C, 0x3C, 0x00, 0x00, 0x00,  // char 34
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x20, 0x20, 0xE0, 0xFC, 0x3C, 0x20, 0xE0, 0xFC, 0x3C, 0x20,  // char 35
+0x00, 0x04, 0x3C, 0x3F, 0x07, 0x04, 0x3C, 0x3F, 0x07, 0x04, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xF8, 0x98, 0xFE, 0xFE, 0x98, 0x98, 0x10, 0x00, 0x00,  // char 36
+0x00, 0x00, 0x08, 0x19, 0x19, 0x7F, 0x7F, 0x19, 0x1F, 0x0F, 0x00, 0x00,
+0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x00,  // char 37
+0x00, 0x30, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x38, 0x38, 0x38, 0x00,
+0x00, 0x00, 0x00, 0xB8, 0xFC, 0xC6, 0xE2, 0x3E, 0x1C, 0x00, 0x00, 0x00,  // char 38
+0x00, 0x00, 0x1F, 0x3F, 0x31, 0x21, 0x37, 0x1E, 0x1C, 0x36, 0x22, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4E, 0x7E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 39
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xE0, 0xF8, 0xFC, 0x0E, 0x02, 0x02, 0x00, 0x00, 0x00,  // char 40
+0x00, 0x00, 0x00, 0x07, 0x1F, 0x3F, 0x70, 0x40, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x02, 0x0E, 0xFC, 0xF8, 0xE0, 0x00, 0x00, 0x00,  // char 41
+0x00, 0x00, 0x00, 0x40, 0x40, 0x70, 0x3F, 0x1F, 0x07, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x98, 0xB8, 0xE0, 0xF8, 0xF8, 0xE0, 0xB8, 0x98, 0x00, 0x00,  // char 42
+0x00, 0x00, 0x0C, 0x0E, 0x03, 0x0F, 0x0F, 0x03, 0x0E, 0x0C, 0x00, 0x00,
+0x00, 0x00, 0x80, 0x80, 0x80, 0xF0, 0xF0, 0x80, 0x80, 0x80, 0x00, 0x00,  // char 43
+0x00, 0x00, 0x01, 0x01, 0x01, 0x0F, 0x0F, 0x01, 0x01, 0x01, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 44
+0x00, 0x00, 0x00, 0x00, 0x5C, 0x7C, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00,  // char 45
+0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 46
+0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x00,  // char 47
+0x00, 0x18, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xF0, 0xFC, 0x0C, 0x06, 0x06, 0x86, 0xC6, 0x66, 0x3C, 0xFC, 0xF0,  // char 48
+0x00, 0x0F, 0x3F, 0x3C, 0x66, 0x63, 0x61, 0x60, 0x60, 0x30, 0x3F, 0x0F,
+0x00, 0x00, 0x18, 0x18, 0x1C, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 49
+0x00, 0x00, 0x60, 0x60, 0x60, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x00, 0x00,
+0x00, 0x38, 0x3C, 0x0E, 0x06, 0x06, 0x06, 0x86, 0xC6, 0xEE, 0x7C, 0x38,  // char 50
+0x00, 0x60, 0x70, 0x78, 0x7C, 0x6E, 0x67, 0x63, 0x61, 0x60, 0x60, 0x60,
+0x00, 0x18, 0x1C, 0x0E, 0x86, 0x86, 0x86, 0x86, 0x86, 0xCE, 0xFC, 0x78,  // char 51
+0x00, 0x18, 0x38, 0x70, 0x61, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3E, 0x1C,
+0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0xFE, 0xFE, 0x00, 0x00,  // char 52
+0x00, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x7F, 0x7F, 0x06, 0x06,
+0x00, 0x7E, 0xFE, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x86, 0x06,  // char 53
+0x00, 0x18, 0x38, 0x70, 0x60, 0x60, 0x60, 0x60, 0x60, 0x71, 0x3F, 0x1F,
+0x00, 0x80, 0xE0, 0xF0, 0xB8, 0x9C, 0x8E, 0x86, 0x86, 0x86, 0x00, 0x00,  // char 54
+0x00, 0x1F, 0x3F, 0x73, 0x61, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3F, 0x1E,
+0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x86, 0xE6, 0x7E, 0x1E, 0x06,  // char 55
+0x00, 0x00, 0x00, 0x00, 0x60, 0x78, 0x1E, 0x07, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x78, 0xFC, 0xCE, 0x86, 0x86, 0x86, 0xCE, 0xFC, 0x78, 0x00,  // char 56
+0x00, 0x1E, 0x3F, 0x73, 0x61, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3F, 0x1E,
+0x00, 0x78, 0xFC, 0xCE, 0x86, 0x86, 0x86, 0x86, 0x86, 0xCE, 0xFC, 0xF8,  // char 57
+0x00, 0x00, 0x00, 0x61, 0x61, 0x61, 0x71, 0x39, 0x1D, 0x0F, 0x07, 0x01,
+0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 58
+0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 59
+0x00, 0x00, 0x00, 0x00, 0x4E, 0x7E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x06, 0x00, 0x00,  // char 60
+0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00,  // char 61
+0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00,
+0x00, 0x00, 0x06, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00,  // char 62
+0x00, 0x00, 0x60, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x01, 0x00, 0x00,
+0x00, 0x38, 0x3C, 0x0E, 0x06, 0x06, 0x86, 0xC6, 0xEE, 0x7C, 0x38, 0x00,  // char 63
+0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x6F, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xF0, 0xFC, 0x0E, 0xE6, 0xF6, 0x36, 0xF6, 0xF6, 0x0E, 0xFC, 0xF0,  // char 64
+0x00, 0x1F, 0x3F, 0x30, 0x67, 0x6F, 0x6C, 0x6F, 0x6F, 0x6C, 0x07, 0x03,
+0x00, 0x00, 0x00, 0xC0, 0xF8, 0x3E, 0x3E, 0xF8, 0xC0, 0x00, 0x00, 0x00,  // char 65
+0x00, 0x70, 0x7E, 0x0F, 0x0D, 0x0C, 0x0C, 0x0D, 0x0F, 0x7E, 0x70, 0x00,
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0x86, 0xCE, 0xFC, 0x78, 0x00, 0x00,  // char 66
+0x00, 0x7F, 0x7F, 0x61, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3F, 0x1E, 0x00,
+0x00, 0xE0, 0xF8, 0x1C, 0x0E, 0x06, 0x06, 0x06, 0x0E, 0x1C, 0x18, 0x00,  // char 67
+0x00, 0x07, 0x1F, 0x38, 0x70, 0x60, 0x60, 0x60, 0x70, 0x38, 0x18, 0x00,
+0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x1C, 0xF8, 0xE0, 0x00,  // char 68
+0x00, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x70, 0x38, 0x1F, 0x07, 0x00,
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00,  // char 69
+0x00, 0x7F, 0x7F, 0x61, 0x61, 0x61, 0x61, 0x61, 0x61, 0x60, 0x60, 0x00,
+0x00, 0xFE, 0xFE, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x06, 0x06, 0x00,  // char 70
+0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+0x00, 0xE0, 0xF8, 0x1C, 0x0E, 0x06, 0x86, 0x86, 0x86, 0x8E, 0x8C, 0x00,  // char 71
+0x00, 0x07, 0x1F, 0x38, 0x70, 0x60, 0x61, 0x61, 0x61, 0x7F, 0x7F, 0x00,
+0x00, 0xFE, 0xFE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFE, 0xFE, 0x00,  // char 72
+0x00, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x7F, 0x7F, 0x00,
+0x00, 0x00, 0x00, 0x06, 0x06, 0xFE, 0xFE, 0x06, 0x06, 0x00, 0x00, 0x00,  // char 73
+0x00, 0x00, 0x00, 0x60, 0x60, 0x7F, 0x7F, 0x60, 0x60, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00,  // char 74
+0x00, 0x1C, 0x3C, 0x70, 0x60, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x0F, 0x00,
+0x00, 0xFE, 0xFE, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x06, 0x00,  // char 75
+0x00, 0x7F, 0x7F, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x70, 0x60, 0x00,
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 76
+0x00, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00,
+0x00, 0xFE, 0xFE, 0x3C, 0xF0, 0xC0, 0xC0, 0xF0, 0x3C, 0xFE, 0xFE, 0x00,  // char 77
+0x00, 0x7F, 0x7F, 0x00, 0x00, 0x03, 0x03, 0x00, 0x00, 0x7F, 0x7F, 0x00,
+0x00, 0xFE, 0xFE, 0x1C, 0x70, 0xE0, 0x80, 0x00, 0x00, 0xFE, 0xFE, 0x00,  // char 78
+0x00, 0x7F, 0x7F, 0x00, 0x00, 0x01, 0x07, 0x0E, 0x38, 0x7F, 0x7F, 0x00,
+0x00, 0xE0, 0xF8, 0x1C, 0x0E, 0x06, 0x06, 0x0E, 0x1C, 0xF8, 0xE0, 0x00,  // char 79
+0x00, 0x07, 0x1F, 0x38, 0x70, 0x60, 0x60, 0x70, 0x38, 0x1F, 0x07, 0x00,
+0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x8E, 0xFC, 0xF8, 0x00,  // char 80
+0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00,
+0x00, 0xE0, 0xF8, 0x1C, 0x0E, 0x06, 0x06, 0x0E, 0x1C, 0xF8, 0xE0, 0x00,  // char 81
+0x00, 0x07, 0x1F, 0x38, 0x70, 0x60, 0x6C, 0x7C, 0x38, 0x7F, 0x67, 0x00,
+0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x06, 0x8E, 0xFC, 0xF8, 0x00,  // char 82
+0x00, 0x7F, 0x7F, 0x03, 0x03, 0x07, 0x0F, 0x1F, 0x3B, 0x71, 0x60, 0x00,
+0x00, 0x78, 0xFC, 0xCE, 0x86, 0x86, 0x86, 0x86, 0x8E, 0x1C, 0x18, 0x00,  // char 83
+0x00, 0x18, 0x38, 0x71, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3F, 0x1E, 0x00,
+0x00, 0x00, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x00, 0x00,  // char 84
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00,  // char 85
+0x00, 0x0F, 0x3F, 0x70, 0x60, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x0F, 0x00,
+0x00, 0x0E, 0x7E, 0xF0, 0x80, 0x00, 0x00, 0x80, 0xF0, 0x7E, 0x0E, 0x00,  // char 86
+0x00, 0x00, 0x00, 0x03, 0x1F, 0x7C, 0x7C, 0x1F, 0x03, 0x00, 0x00, 0x00,
+0x00, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0x00,  // char 87
+0x00, 0x7F, 0x7F, 0x38, 0x0C, 0x07, 0x07, 0x0C, 0x38, 0x7F, 0x7F, 0x00,
+0x00, 0x06, 0x1E, 0x38, 0x60, 0xC0, 0xC0, 0x60, 0x38, 0x1E, 0x06, 0x00,  // char 88
+0x00, 0x60, 0x78, 0x1C, 0x06, 0x03, 0x03, 0x06, 0x1C, 0x78, 0x60, 0x00,
+0x00, 0x06, 0x1E, 0x78, 0xE0, 0x80, 0x80, 0xE0, 0x78, 0x1E, 0x06, 0x00,  // char 89
+0x00, 0x00, 0x00, 0x00, 0x01, 0x7F, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0x06, 0x06, 0x06, 0x86, 0xC6, 0x66, 0x3E, 0x1E, 0x06, 0x00,  // char 90
+0x00, 0x60, 0x78, 0x7C, 0x66, 0x63, 0x61, 0x60, 0x60, 0x60, 0x60, 0x00,
+0x00, 0x00, 0x00, 0xFE, 0xFE, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00,  // char 91
+0x00, 0x00, 0x00, 0x7F, 0x7F, 0x60, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00,
+0x00, 0x1C, 0x38, 0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 92
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C, 0x38, 0x00,
+0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0xFE, 0xFE, 0x00, 0x00, 0x00,  // char 93
+0x00, 0x00, 0x00, 0x60, 0x60, 0x60, 0x60, 0x7F, 0x7F, 0x00, 0x00, 0x00,
+0x00, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x1C, 0x38, 0x70, 0xE0, 0xC0,  // char 94
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 95
+0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x7E, 0x4E, 0x00, 0x00, 0x00, 0x00,  // char 96
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x40, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00,  // char 97
+0x00, 0x1C, 0x3E, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x3F, 0x00,
+0x00, 0xFE, 0xFE, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00,  // char 98
+0x00, 0x7F, 0x7F, 0x61, 0x60, 0x60, 0x60, 0x60, 0x71, 0x3F, 0x1F, 0x00,
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x00,  // char 99
+0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x30, 0x18, 0x08, 0x00,
+0x00, 0x00, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0xFE, 0xFE, 0x00,  // char 100
+0x00, 0x1F, 0x3F, 0x71, 0x60, 0x60, 0x60, 0x61, 0x61, 0x7F, 0x7F, 0x00,
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xC0, 0x80, 0x00,  // char 101
+0x00, 0x0F, 0x1F, 0x3B, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0x01, 0x00,
+0x00, 0x00, 0x80, 0x80, 0xF8, 0xFC, 0x8E, 0x86, 0x86, 0x06, 0x00, 0x00,  // char 102
+0x00, 0x00, 0x01, 0x01, 0x7F, 0x7F, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF0, 0xF0, 0x00,  // char 103
+0x00, 0x01, 0x63, 0x67, 0x66, 0x66, 0x66, 0x66, 0x73, 0x3F, 0x1F, 0x00,
+0x00, 0xFE, 0xFE, 0x80, 0xC0, 0xC0, 0xC0, 0xC0, 0x80, 0x00, 0x00, 0x00,  // char 104
+0x00, 0x7F, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x01, 0x7F, 0x7F, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x60, 0xEC, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 105
+0x00, 0x00, 0x00, 0x30, 0x30, 0x3F, 0x3F, 0x30, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xF6, 0xF6, 0x00, 0x00, 0x00,  // char 106
+0x00, 0x00, 0x00, 0x30, 0x70, 0x60, 0x60, 0x7F, 0x3F, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0x80, 0xC0, 0xC0, 0x00, 0x00, 0x00,  // char 107
+0x00, 0x00, 0x7F, 0x7F, 0x06, 0x0F, 0x1F, 0x39, 0x70, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x06, 0xFE, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 108
+0x00, 0x00, 0x00, 0x60, 0x60, 0x7F, 0x7F, 0x60, 0x60, 0x00, 0x00, 0x00,
+0x00, 0xE0, 0xC0, 0xE0, 0xE0, 0xC0, 0xC0, 0xE0, 0xE0, 0xC0, 0x80, 0x00,  // char 109
+0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x3F, 0x3F, 0x00,
+0x00, 0x00, 0xE0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,  // char 110
+0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x3F, 0x00,
+0x00, 0x80, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x80, 0x00,  // char 111
+0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x38, 0x1F, 0x0F, 0x00,
+0x00, 0xF0, 0xF0, 0x30, 0x30, 0x30, 0x30, 0x30, 0x70, 0xE0, 0xC0, 0x00,  // char 112
+0x00, 0x7F, 0x7F, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x0E, 0x07, 0x03, 0x00,
+0x00, 0xC0, 0xE0, 0x70, 0x30, 0x30, 0x30, 0x30, 0x30, 0xF0, 0xF0, 0x00,  // char 113
+0x00, 0x03, 0x07, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x06, 0x7F, 0x7F, 0x00,
+0x00, 0x00, 0xE0, 0xE0, 0xC0, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xC0, 0x00,  // char 114
+0x00, 0x00, 0x3F, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xC0, 0xE0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x40, 0x00, 0x00,  // char 115
+0x00, 0x00, 0x11, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x1E, 0x00, 0x00,
+0x00, 0x00, 0x60, 0x60, 0xFE, 0xFE, 0x60, 0x60, 0x60, 0x00, 0x00, 0x00,  // char 116
+0x00, 0x00, 0x00, 0x00, 0x1F, 0x3F, 0x30, 0x30, 0x30, 0x30, 0x00, 0x00,
+0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00,  // char 117
+0x00, 0x0F, 0x1F, 0x38, 0x30, 0x30, 0x30, 0x30, 0x18, 0x3F, 0x3F, 0x00,
+0x00, 0x60, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xE0, 0x60, 0x00,  // char 118
+0x00, 0x00, 0x01, 0x07, 0x1E, 0x38, 0x38, 0x1E, 0x07, 0x01, 0x00, 0x00,
+0x00, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0xE0, 0xE0, 0x00,  // char 119
+0x00, 0x07, 0x1F, 0x38, 0x1C, 0x0F, 0x0F, 0x1C, 0x38, 0x1F, 0x07, 0x00,
+0x00, 0x60, 0xE0, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0xE0, 0x60, 0x00, 0x00,  // char 120
+0x00, 0x30, 0x38, 0x1D, 0x0F, 0x07, 0x0F, 0x1D, 0x38, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x30, 0xF0, 0xC0, 0x00, 0x00, 0xC0, 0xF0, 0x30, 0x00, 0x00,  // char 121
+0x00, 0x00, 0x00, 0x40, 0x73, 0x3F, 0x0F, 0x03, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x60, 0x60, 0x60, 0x60, 0x60, 0xE0, 0xE0, 0x60, 0x20, 0x00, 0x00,  // char 122
+0x00, 0x30, 0x38, 0x3C, 0x36, 0x33, 0x31, 0x30, 0x30, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x80, 0xC0, 0xFC, 0x7E, 0x07, 0x03, 0x03, 0x03, 0x00, 0x00,  // char 123
+0x00, 0x00, 0x00, 0x01, 0x1F, 0x3F, 0x70, 0x60, 0x60, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 124
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0x03, 0x03, 0x07, 0x7E, 0xFC, 0xC0, 0x80, 0x00, 0x00,  // char 125
+0x00, 0x00, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x10, 0x18, 0x0C, 0x04, 0x0C, 0x18, 0x10, 0x18, 0x0C, 0x04, 0x00,  // char 126
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x30, 0x60, 0xC0, 0x80, 0x00, 0x00,  // char 127
+0x00, 0x0F, 0x0F, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0F, 0x0F, 0x00,
+};
+
+const unsigned char Font_6x8_page_major[] = {
+6, 8, 32, 127,        // header
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 32
+0x00, 0x00, 0x5F, 0x00, 0x00, 0x00,  // char 33
+0x00, 0x07, 0x00, 0x07, 0x00, 0x00,  // char 34
+0x14, 0x7F, 0x14, 0x7F, 0x14, 0x00,  // char 35
+0x24, 0x2A, 0x7F, 0x2A, 0x12, 0x00,  // char 36
+0x23, 0x13, 0x08, 0x64, 0x62, 0x00,  // char 37
+0x36, 0x49, 0x55, 0x22, 0x50, 0x00,  // char 38
+0x00, 0x05, 0x03, 0x00, 0x00, 0x00,  // char 39
+0x00, 0x1C, 0x22, 0x41, 0x00, 0x00,  // char 40
+0x00, 0x41, 0x22, 0x1C, 0x00, 0x00,  // char 41
+0x08, 0x2A, 0x1C, 0x2A, 0x08, 0x00,  // char 42
+0x08, 0x08, 0x3E, 0x08, 0x08, 0x00,  // char 43
+0x00, 0x50, 0x30, 0x00, 0x00, 0x00,  // char 44
+0x08, 0x08, 0x08, 0x08, 0x08, 0x00,  // char 45
+0x00, 0x30, 0x30, 0x00, 0x00, 0x00,  // char 46
+0x20, 0x10, 0x08, 0x04, 0x02, 0x00,  // char 47
+0x3E, 0x51, 0x49, 0x45, 0x3E, 0x00,  // char 48
+0x00, 0x42, 0x7F, 0x40, 0x00, 0x00,  // char 49
+0x42, 0x61, 0x51, 0x49, 0x46, 0x00,  // char 50
+0x21, 0x41, 0x45, 0x4B, 0x31, 0x00,  // char 51
+0x18, 0x14, 0x12, 0x7F, 0x10, 0x00,  // char 52
+0x27, 0x45, 0x45, 0x45, 0x39, 0x00,  // char 53
+0x3C, 0x4A, 0x49, 0x49, 0x30, 0x00,  // char 54
+0x01, 0x71, 0x09, 0x05, 0x03, 0x00,  // char 55
+0x36, 0x49, 0x49, 0x49, 0x36, 0x00,  // char 56
+0x06, 0x49, 0x49, 0x29, 0x1E, 0x00,  // char 57
+0x00, 0x36, 0x36, 0x00, 0x00, 0x00,  // char 58
+0x00, 0x56, 0x36, 0x00, 0x00, 0x00,  // char 59
+0x00, 0x08, 0x14, 0x22, 0x41, 0x00,  // char 60
+0x14, 0x14, 0x14, 0x14, 0x14, 0x00,  // char 61
+0x41, 0x22, 0x14, 0x08, 0x00, 0x00,  // char 62
+0x02, 0x01, 0x51, 0x09, 0x06, 0x00,  // char 63
+0x32, 0x49, 0x79, 0x41, 0x3E, 0x00,  // char 64
+0x7E, 0x11, 0x11, 0x11, 0x7E, 0x00,  // char 65
+0x7F, 0x49, 0x49, 0x49, 0x36, 0x00,  // char 66
+0x3E, 0x41, 0x41, 0x41, 0x22, 0x00,  // char 67
+0x7F, 0x41, 0x41, 0x22, 0x1C, 0x00,  // char 68
+0x7F, 0x49, 0x49, 0x49, 0x41, 0x00,  // char 69
+0x7F, 0x09, 0x09, 0x01, 0x01, 0x00,  // char 70
+0x3E, 0x41, 0x41, 0x51, 0x32, 0x00,  // char 71
+0x7F, 0x08, 0x08, 0x08, 0x7F, 0x00,  // char 72
+0x00, 0x41, 0x7F, 0x41, 0x00, 0x00,  // char 73
+0x20, 0x40, 0x41, 0x3F, 0x01, 0x00,  // char 74
+0x7F, 0x08, 0x14, 0x22, 0x41, 0x00,  // char 75
+0x7F, 0x40, 0x40, 0x40, 0x40, 0x00,  // char 76
+0x7F, 0x02, 0x04, 0x02, 0x7F, 0x00,  // char 77
+0x7F, 0x04, 0x08, 0x10, 0x7F, 0x00,  // char 78
+0x3E, 0x41, 0x41, 0x41, 0x3E, 0x00,  // char 79
+0x7F, 0x09, 0x09, 0x09, 0x06, 0x00,  // char 80
+0x3E, 0x41, 0x51, 0x21, 0x5E, 0x00,  // char 81
+0x7F, 0x09, 0x19, 0x29, 0x46, 0x00,  // char 82
+0x46, 0x49, 0x49, 0x49, 0x31, 0x00,  // char 83
+0x01, 0x01, 0x7F, 0x01, 0x01, 0x00,  // char 84
+0x3F, 0x40, 0x40, 0x40, 0x3F, 0x00,  // char 85
+0x1F, 0x20, 0x40, 0x20, 0x1F, 0x00,  // char 86
+0x7F, 0x20, 0x18, 0x20, 0x7F, 0x00,  // char 87
+0x63, 0x14, 0x08, 0x14, 0x63, 0x00,  // char 88
+0x03, 0x04, 0x78, 0x04, 0x03, 0x00,  // char 89
+0x61, 0x51, 0x49, 0x45, 0x43, 0x00,  // char 90
+0x00, 0x00, 0x7F, 0x41, 0x41, 0x00,  // char 91
+0x02, 0x04, 0x08, 0x10, 0x20, 0x00,  // char 92
+0x41, 0x41, 0x7F, 0x00, 0x00, 0x00,  // char 93
+0x04, 0x02, 0x01, 0x02, 0x04, 0x00,  // char 94
+0x40, 0x40, 0x40, 0x40, 0x40, 0x00,  // char 95
+0x00, 0x01, 0x02, 0x04, 0x00, 0x00,  // char 96
+0x20, 0x54, 0x54, 0x54, 0x78, 0x00,  // char 97
+0x7F, 0x48, 0x44, 0x44, 0x38, 0x00,  // char 98
+0x38, 0x44, 0x44, 0x44, 0x20, 0x00,  // char 99
+0x38, 0x44, 0x44, 0x48, 0x7F, 0x00,  // char 100
+0x38, 0x54, 0x54, 0x54, 0x18, 0x00,  // char 101
+0x08, 0x7E, 0x09, 0x01, 0x02, 0x00,  // char 102
+0x08, 0x14, 0x54, 0x54, 0x3C, 0x00,  // char 103
+0x7F, 0x08, 0x04, 0x04, 0x78, 0x00,  // char 104
+0x00, 0x44, 0x7D, 0x40, 0x00, 0x00,  // char 105
+0x20, 0x40, 0x44, 0x3D, 0x00, 0x00,  // char 106
+0x00, 0x7F, 0x10, 0x28, 0x44, 0x00,  // char 107
+0x00, 0x41, 0x7F, 0x40, 0x00, 0x00,  // char 108
+0x7C, 0x04, 0x18, 0x04, 0x78, 0x00,  // char 109
+0x7C, 0x08, 0x04, 0x04, 0x78, 0x00,  // char 110
+0x38, 0x44, 0x44, 0x44, 0x38, 0x00,  // char 111
+0x7C, 0x14, 0x14, 0x14, 0x08, 0x00,  // char 112
+0x08, 0x14, 0x14, 0x18, 0x7C, 0x00,  // char 113
+0x7C, 0x08, 0x04, 0x04, 0x08, 0x00,  // char 114
+0x48, 0x54, 0x54, 0x54, 0x20, 0x00,  // char 115
+0x04, 0x3F, 0x44, 0x40, 0x20, 0x00,  // char 116
+0x3C, 0x40, 0x40, 0x20, 0x7C, 0x00,  // char 117
+0x1C, 0x20, 0x40, 0x20, 0x1C, 0x00,  // char 118
+0x3C, 0x40, 0x30, 0x40, 0x3C, 0x00,  // char 119
+0x44, 0x28, 0x10, 0x28, 0x44, 0x00,  // char 120
+0x0C, 0x50, 0x50, 0x50, 0x3C, 0x00,  // char 121
+0x44, 0x64, 0x54, 0x4C, 0x44, 0x00,  // char 122
+0x00, 0x08, 0x36, 0x41, 0x00, 0x00,  // char 123
+0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,  // char 124
+0x00, 0x41, 0x36, 0x08, 0x00, 0x00,  // char 125
+0x08, 0x08, 0x2A, 0x1C, 0x08, 0x00,  // char 126
+0x08, 0x1C, 0x2A, 0x08, 0x08, 0x00,  // char 127
+};
+
+const unsigned char Segment_25x40_page_major[] = {
+25, 40, 46, 58,        // header
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 46
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 47
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xE0, 0xC4, 0x8C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x8C, 0xC4, 0xE0, 0xF0, 0x00, 0x00,  // char 48
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0xF7, 0xE3, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xE3, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x03, 0x11, 0x18, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x11, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x00, 0x00,  // char 49
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xE3, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x8C, 0xC4, 0xE0, 0xF0, 0x00, 0x00,  // char 50
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xE0, 0xC0, 0x88, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x08, 0x01, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x03, 0x11, 0x18, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x8C, 0xC4, 0xE0, 0xF0, 0x00, 0x00,  // char 51
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x88, 0xC1, 0xE3, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x11, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0xF0, 0x00, 0x00,  // char 52
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x03, 0x01, 0x08, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x88, 0xC1, 0xE3, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xE0, 0xC4, 0x8C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00,  // char 53
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x03, 0x01, 0x08, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x88, 0xC0, 0xE0, 0xF0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x11, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  // char 54
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xF7, 0xE3, 0xC1, 0x88, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x88, 0xC0, 0xE0, 0xF0, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x03, 0x11, 0x18, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x11, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x8C, 0xC4, 0xE0, 0xF0, 0x00, 0x00,  // char 55
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xC1, 0xE3, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xE0, 0xC4, 0x8C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x8C, 0xC4, 0xE0, 0xF0, 0x00, 0x00,  // char 56
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0xF7, 0xE3, 0xC1, 0x88, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x88, 0xC1, 0xE3, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x03, 0x11, 0x18, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x11, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0xF0, 0xE0, 0xC4, 0x8C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x8C, 0xC4, 0xE0, 0xF0, 0x00, 0x00,  // char 57
+0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x07, 0x03, 0x01, 0x08, 0x1C, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x3E, 0x1C, 0x88, 0xC1, 0xE3, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x0C, 0x1C, 0x3C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x7C, 0x3C, 0x1C, 0x0C, 0x04, 0x00, 0x00, 0x00, 0x00,  // char 58
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x1C, 0x1E, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1E, 0x1C, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00,
+};
+
+#endif  /* __FONT_PAGE_MAJOR_H__ */
@@ -24,6 +24,8 @@ struct menu {
 extern struct menu primary_menu;
 extern struct menu gamepad_mode_menu;
 extern struct menu bump_mode_menu;
+extern struct menu activity_mode_menu;
+extern struct menu lab_mode_menu;
 extern struct menu test_mode_menu;
 extern struct menu test_mode_2_menu;
 
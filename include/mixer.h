@@ -0,0 +1,22 @@
+/**
+ * @file    mixer.h
+ * @author  Jim Herd
+ * @brief   Differential drive mixer
+ */
+
+#ifndef __MIXER_H__
+#define __MIXER_H__
+
+#include    "system.h"
+
+struct mixer_output_s {
+    int8_t      left_pwm;           // -100% to +100%
+    int8_t      right_pwm;
+    bool        saturated;          // speeds scaled down to fit
+} ;
+
+void    mixer_wheel_speeds(int32_t linear_mm_s, int32_t differential_mm_s, struct mixer_output_s *output);
+void    mixer_throttle_curvature(int16_t throttle, int16_t curvature, struct mixer_output_s *output);
+void    mixer_linear_angular(int16_t linear_mm_s, int16_t angular_degrees_s, struct mixer_output_s *output);
+
+#endif  /* __MIXER_H__ */
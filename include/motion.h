@@ -0,0 +1,21 @@
+/**
+ * @file    motion.h
+ * @author  Jim Herd
+ * @brief   Motion primitive API (drive, rotate, arc)
+ */
+
+#ifndef __MOTION_H__
+#define __MOTION_H__
+
+#include    "system.h"
+
+#include    "FreeRTOS.h"
+
+void    motion_drive(int16_t distance_mm, int16_t speed_mm_s);
+void    motion_rotate(int16_t angle_degrees, int16_t speed_mm_s);
+void    motion_arc(int16_t radius_mm, int16_t angle_degrees, int16_t speed_mm_s);
+bool    motion_wait_idle(TickType_t time_out);
+bool    motion_busy(void);
+void    motion_stop(void);
+
+#endif  /* __MOTION_H__ */
@@ -0,0 +1,16 @@
+/**
+ * @file    odometry.h
+ * @author  Jim Herd
+ * @brief   Dead-reckoning odometry for the differential drive
+ */
+
+#ifndef __ODOMETRY_H__
+#define __ODOMETRY_H__
+
+#include    "system.h"
+#include    "drive_model.h"
+
+void     odometry_reset(void);
+void     odometry_update(void);
+
+#endif  /* __ODOMETRY_H__ */
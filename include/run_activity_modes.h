@@ -0,0 +1,13 @@
+/**
+ * @file run_activity_modes.h
+ * @author Jim Herd
+ * @brief 
+ */
+
+#ifndef __RUN_ACTIVITY_MODES_H__
+#define __RUN_ACTIVITY_MODES_H__
+
+error_codes_te run_activity_modes(uint8_t mode_index, uint32_t parameter);
+error_codes_te execute_activity(uint8_t mode_index, uint32_t  parameter);
+
+#endif  /* __RUN_ACTIVITY_MODES_H__  */
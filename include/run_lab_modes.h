@@ -0,0 +1,13 @@
+/**
+ * @file run_lab_modes.h
+ * @author Jim Herd
+ * @brief 
+ */
+
+#ifndef __RUN_LAB_MODES_H__
+#define __RUN_LAB_MODES_H__
+
+error_codes_te run_lab_modes(uint8_t mode_index, uint32_t parameter);
+error_codes_te execute_lab_chart(uint8_t mode_index, uint32_t  parameter);
+
+#endif  /* __RUN_LAB_MODES_H__  */
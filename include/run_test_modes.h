@@ -15,5 +15,15 @@ error_codes_te run_test_2(uint8_t mode_index, uint32_t parameter);
 error_codes_te run_test_3(uint8_t mode_index, uint32_t parameter);
 error_codes_te run_test_4(uint8_t mode_index, uint32_t parameter);
 error_codes_te run_test_5(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_6(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_7(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_8(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_9(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_10(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_11(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_12(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_13(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_14(uint8_t mode_index, uint32_t parameter);
+error_codes_te run_test_15(uint8_t mode_index, uint32_t parameter);
 
 #endif  /* __RUN_TEST_MODES_H__  */
\ No newline at end of file
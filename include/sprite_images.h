@@ -0,0 +1,112 @@
+/**
+ * @file    sprite_images.h
+ * @author  Jim Herd
+ * @brief   Frames of sprite animations (see sprites.c)
+ *
+ * @note
+ * 16x16 pixels, page-major as display RAM : 16 bytes of page 0 (rows
+ * 0-7, bit 0 at top) then 16 bytes of page 1.  Include only in sprites.c
+ */
+
+#ifndef __SPRITE_IMAGES_H__
+#define __SPRITE_IMAGES_H__
+
+//==============================================================================
+// Busy spinner : dot with two trailing dots rotating round a circle
+//==============================================================================
+
+// spinner mask : disc, opaque over background
+static const uint8_t spinner_mask[] = {
+    0xE0, 0xF8, 0xFC, 0xFE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFE, 0xFC, 0xF8, 0xE0,
+    0x07, 0x1F, 0x3F, 0x7F, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x7F, 0x3F, 0x1F, 0x07,
+};
+
+// spinner frame 0
+static const uint8_t spinner_0[] = {
+    0x00, 0x80, 0x80, 0x18, 0x18, 0x00, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// spinner frame 1
+static const uint8_t spinner_1[] = {
+    0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x06, 0x06, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// spinner frame 2
+static const uint8_t spinner_2[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x18, 0x18, 0xC0, 0xC0, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+};
+
+// spinner frame 3
+static const uint8_t spinner_3[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x00, 0x00,
+};
+
+// spinner frame 4
+static const uint8_t spinner_4[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00,
+};
+
+// spinner frame 5
+static const uint8_t spinner_5[] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x1C, 0x1C, 0x1C, 0x00, 0x30, 0x30, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00,
+};
+
+// spinner frame 6
+static const uint8_t spinner_6[] = {
+    0xC0, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x01, 0x01, 0x0C, 0x0C, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+// spinner frame 7
+static const uint8_t spinner_7[] = {
+    0x00, 0x80, 0x9C, 0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0x01, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+//==============================================================================
+// Battery charging : outline filling with 0 to 4 charge bars
+//==============================================================================
+
+// battery mask : outline and inside, opaque
+static const uint8_t battery_mask[] = {
+    0x00, 0x00, 0x00, 0xF8, 0xF8, 0xF8, 0xFE, 0xFE, 0xFE, 0xFE, 0xF8, 0xF8, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+};
+
+// battery frame 0 : 0 charge bars
+static const uint8_t battery_0[] = {
+    0x00, 0x00, 0x00, 0xF8, 0x08, 0x08, 0x0E, 0x0E, 0x0E, 0x0E, 0x08, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0x00, 0x00,
+};
+
+// battery frame 1 : 1 charge bars
+static const uint8_t battery_1[] = {
+    0x00, 0x00, 0x00, 0xF8, 0x08, 0x08, 0x0E, 0x0E, 0x0E, 0x0E, 0x08, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x80, 0xFF, 0x00, 0x00, 0x00,
+};
+
+// battery frame 2 : 2 charge bars
+static const uint8_t battery_2[] = {
+    0x00, 0x00, 0x00, 0xF8, 0x08, 0x08, 0x0E, 0x0E, 0x0E, 0x0E, 0x08, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0xEC, 0x80, 0xFF, 0x00, 0x00, 0x00,
+};
+
+// battery frame 3 : 3 charge bars
+static const uint8_t battery_3[] = {
+    0x00, 0x00, 0x00, 0xF8, 0x08, 0x88, 0x8E, 0x8E, 0x8E, 0x8E, 0x88, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0x80, 0xFF, 0x00, 0x00, 0x00,
+};
+
+// battery frame 4 : 4 charge bars
+static const uint8_t battery_4[] = {
+    0x00, 0x00, 0x00, 0xF8, 0x08, 0xB8, 0xBE, 0xBE, 0xBE, 0xBE, 0xB8, 0x08, 0xF8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0x80, 0xED, 0xED, 0xED, 0xED, 0xED, 0xED, 0x80, 0xFF, 0x00, 0x00, 0x00,
+};
+
+#endif  /* __SPRITE_IMAGES_H__ */
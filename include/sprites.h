@@ -0,0 +1,20 @@
+/**
+ * @file    sprites.h
+ * @author  Jim Herd
+ * @brief   Animated sprites on SSD1306 display
+ */
+
+#ifndef __SPRITES_H__
+#define __SPRITES_H__
+
+#include    "system.h"
+
+extern const struct sprite_animation_s  spinner_animation;
+extern const struct sprite_animation_s  battery_charge_animation;
+
+void    sprite_init(struct sprite_s *sprite, const struct sprite_animation_s *animation, int16_t x, int16_t y);
+void    sprite_move(struct sprite_s *sprite, int16_t x, int16_t y);
+bool    sprite_update(struct sprite_s *sprites, uint8_t nos_sprites);
+void    sprite_hide(struct sprite_s *sprites, uint8_t nos_sprites);
+
+#endif  /* __SPRITES_H__ */
@@ -0,0 +1,16 @@
+/**
+ * @file    strip_chart.h
+ * @author  Jim Herd
+ * @brief   Scrolling strip chart of analogue channels on SSD1306 display
+ */
+
+#ifndef __STRIP_CHART_H__
+#define __STRIP_CHART_H__
+
+#include    "system.h"
+
+void    strip_chart_init(struct strip_chart_s *chart, uint8_t nos_channels, uint8_t decimation);
+bool    strip_chart_add_sample(struct strip_chart_s *chart, const uint8_t *values);
+void    strip_chart_redraw(struct strip_chart_s *chart);
+
+#endif  /* __STRIP_CHART_H__ */
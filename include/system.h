@@ -15,6 +15,7 @@
 #include    "event_groups.h"
 
 #include    "error_codes.h"
+#include    "drive_model.h"      // wheel geometry, odometry and motor model constants
 
 //==============================================================================
 // Version number
@@ -93,6 +94,42 @@ typedef enum {LOW, HIGH, PWM} DRV8833_in_t;
 
 #define     ZERO_CROSS_OVER_DELAY_MS    (10/portTICK_PERIOD_MS)
 
+//==============================================================================
+// Motor command deadlines
+//
+// Commands are time stamped when sent. A MOVE command that waits in the
+// queue for longer than its deadline is dropped. Stop commands never expire.
+
+#define     MOTOR_CMD_NO_DEADLINE           0
+#define     MOTOR_CMD_DEFAULT_DEADLINE_MS   50
+
+#define     MOTOR_CMD_LATENCY_BINS          8       // bin n : latency < (128uS << n), last bin is overflow
+#define     MOTOR_CMD_LATENCY_BIN_0_US      128
+
+//==============================================================================
+// Differential drive mixer
+//
+// Throttle is Q15 (32767 = full speed forward).
+// Curvature is Q14 (16384 = 1.0) : left wheel speed = throttle * (1 - curvature),
+// right = throttle * (1 + curvature).  +/-1.0 stops the inside wheel (pivots on
+// it); larger values reverse the inside wheel.  Zero throttle always stops, so
+// spin on the spot with mixer_linear_angular().
+
+#define     MIXER_Q15(x)                    ((int16_t)((x) * 32767))
+#define     MIXER_Q14(x)                    ((int16_t)((x) * 16384))
+
+//==============================================================================
+// Motion primitives
+//
+// Speeds are wheel speeds in mm/S.  Angles are +ve anti-clockwise (left).
+
+typedef enum {MOTION_DRIVE, MOTION_ROTATE, MOTION_ARC} motion_type_te;
+typedef enum {MOTION_IDLE, MOTION_RUNNING} motion_state_te;
+
+#define     MOTION_DEFAULT_SPEED_MM_S       150
+
+#define     MOTION_DONE_EVENT_MASK          (1 << 0)
+
 //==============================================================================
 // 4 push switches + 4 LEDs
 
@@ -207,10 +244,16 @@ enum  gamepad_dpad_Y_axis {Y_AXIS_OFF, Y_AXIS_UP, Y_AXIS_DOWN};
 
 #define SSD1306_LCDWIDTH    128
 #define SSD1306_LCDHEIGHT   64
+#define SSD1306_NOS_PAGES   (SSD1306_LCDHEIGHT / 8)
+#define SSD1306_RAM_SIZE    (SSD1306_LCDWIDTH * SSD1306_NOS_PAGES)
+
+#define SSD1306_DIRTY_MERGE_GAP     8   // join dirty runs closer than this (address window costs ~8 bytes)
 
 #define SS1306_NOS_LCD_ROWS    4
 
-#define NOS_FONTS           2
+#define NOS_FONTS           5
+
+#define LCD_ROW_STRING_LENGTH   ((SSD1306_LCDWIDTH / FONT_6x8_WIDTH) + 1)   // narrowest font + '\0'
 
 #define LCD_NOS_ROW_CHARACTERS     (SSD1306_LCDWIDTH/9)   // does not inclide '\0'
 
@@ -228,6 +271,78 @@ enum  gamepad_dpad_Y_axis {Y_AXIS_OFF, Y_AXIS_UP, Y_AXIS_DOWN};
 #define SSD1306_SPI_SPEED   8000000         // SSD1306 SPIMax=10MHz
 #define SSD1306_I2C_SPEED   (400 * 1000)    // 400K bits/sec
 
+// I2C is probed at Fast-mode Plus speed at initialisation. Failure of the
+// probe, or SSD1306_I2C_FAULT_LIMIT failed transfers at the fast speed,
+// drops the bus back to SSD1306_I2C_SPEED.
+
+#define SSD1306_I2C_FAST_SPEED      (1000 * 1000)   // 1M bits/sec
+#define SSD1306_I2C_FAULT_LIMIT     3
+
+// Display rendering and flush can be run on core 1 as a standalone loop.
+// Row updates are passed from the display task through a lock-free
+// single producer/single consumer ring (size must be a power of 2).
+
+//#define   DISPLAY_ON_CORE1
+#define     DISPLAY_RING_SIZE       8
+
+// Scroller can step the scroll rows with the display start line register,
+// applied to the scroll area only (vertical scroll area command).  The
+// display RAM already holds the rows that move, so a step sends the start
+// line and the incoming row only.  A 128x64 panel shows all of its RAM, so
+// the incoming row cannot be pre-loaded off screen.
+
+//#define   SSD1306_HW_SCROLL
+#define     SCROLL_AREA_FIRST_PAGE  ((SCROLL_ROW_UPPER - 1) * 2)
+#define     SCROLL_AREA_NOS_PAGES   (SCROLL_AREA_NOS_ROWS * 2)
+
+#if defined(SSD1306_HW_SCROLL) && defined(DISPLAY_ON_CORE1)
+    #error "SSD1306_HW_SCROLL is not supported with DISPLAY_ON_CORE1"
+#endif
+
+// I2C transfers are sent by DMA. Calling task sleeps on a task
+// notification (index below) until the I2C STOP is detected.
+
+#define SSD1306_DMA_NOTIFY_INDEX    1
+#define SSD1306_DMA_TIMEOUT_MS      50      // full display is ~25mS at 400K bits/sec
+
+// Display task sleeps until notified (index below) by LCD_write_row() or
+// another producer. Notifications closer together than the minimum
+// interval are combined into one display update.  The minimum interval
+// is set by the class of screen shown (LCD_set_refresh_class), then
+// stretched so that display updates take no more than LCD_BUDGET_PERCENT
+// of the time.  A static screen sends no updates at all.
+
+#define LCD_UPDATE_NOTIFY_INDEX         2
+#define LCD_MENU_UPDATE_INTERVAL_MS     50      // text and menus : max 20 updates/sec
+#define LCD_LIVE_UPDATE_INTERVAL_MS     20      // plots and gauges : max 50 updates/sec
+#define LCD_MAX_UPDATE_INTERVAL_MS      200     // budget never slows updates below 5/sec
+#define LCD_BUDGET_PERCENT              30      // share of CPU time and I2C bus
+
+typedef enum {LCD_CLASS_MENU, LCD_CLASS_LIVE} LCD_class_te;
+
+// Lab mode strip chart. Plot area is the two scroll rows (pages 4 to 7).
+// Each column is the min/max of STRIP_CHART_DECIMATION sensor samples.
+
+#define STRIP_CHART_MAX_CHANNELS    3
+#define STRIP_CHART_NOS_COLUMNS     SSD1306_LCDWIDTH
+#define STRIP_CHART_TOP             ((SCROLL_ROW_UPPER - 1) * 16)
+#define STRIP_CHART_HEIGHT          (SCROLL_AREA_NOS_ROWS * 16)
+#define STRIP_CHART_DECIMATION      5       // 50Hz sensor rate => 10 columns/sec
+
+// Sprites. The display area under a sprite is saved when it is drawn and
+// restored when it moves, changes frame or is hidden. Sprites are updated
+// by their owner every SPRITE_FRAME_MS.
+
+#define SPRITE_MAX_WIDTH            16
+#define SPRITE_MAX_HEIGHT           16      // multiple of 8
+#define SPRITE_BACKGROUND_SIZE      (SPRITE_MAX_WIDTH * ((SPRITE_MAX_HEIGHT / 8) + 1))
+#define SPRITE_FRAME_MS             50      // 20 frames/sec
+
+// Widgets. A screen is a constant table of widgets plus an array of
+// widget state (see widgets.c).
+
+typedef enum {WIDGET_LABEL, WIDGET_VALUE, WIDGET_BAR, WIDGET_ICON} widget_type_te;
+
 // fonts
 
 #define         TERMINAL_9x16_FONT_WIDTH                 9
@@ -236,6 +351,30 @@ enum  gamepad_dpad_Y_axis {Y_AXIS_OFF, Y_AXIS_UP, Y_AXIS_DOWN};
 #define         ROBOKID_LCD_ICONS_FONT_15x16_WIDTH      15
 #define         ROBOKID_LCD_ICONS_FONT_15x16_HEIGHT     16
 
+#define         TERMINAL_12x16_FONT_WIDTH               12
+#define         TERMINAL_12x16_FONT_HEIGHT              16
+
+#define         FONT_6x8_WIDTH                           6
+#define         FONT_6x8_HEIGHT                          8
+
+#define         SEGMENT_25x40_FONT_WIDTH                25
+#define         SEGMENT_25x40_FONT_HEIGHT               40
+
+// font codes : index into font_table[], font_metrics[] and font_data[]
+
+#define         FONT_TERMINAL_9x16      0
+#define         FONT_ICONS_15x16        1
+#define         FONT_TERMINAL_12x16     2
+#define         FONT_6x8                3
+#define         FONT_SEGMENT_25x40      4       // '.', '/', '0'-'9', ':' only
+
+// Optional SRAM cache of glyphs in use (direct mapped). Entries must be a
+// power of 2; 0 disables the cache and glyphs are read from flash.
+// Glyphs larger than SSD1306_GLYPH_CACHE_MAX_BYTES are not cached.
+
+#define         SSD1306_GLYPH_CACHE_ENTRIES             0
+#define         SSD1306_GLYPH_CACHE_MAX_BYTES           32      // 15x16 icon glyph is 30 bytes
+
 // ICON  character codes
 
 #define BLANK           32  // ' '
@@ -394,12 +533,18 @@ typedef enum {PLAY, COLLECT, SAVE, RECALL, DUMP} sequence_mode_te;
 //
 #define GAMEPAD_MODE_0_SLOW_SPEED  60
 #define GAMEPAD_MODE_0_FAST_SPEED  80
+//
+// 2. gamepad mode 1 : diagonal dpad gives smooth arcs
+//
+#define GAMEPAD_MODE_1_SLOW_THROTTLE   MIXER_Q15(0.5)
+#define GAMEPAD_MODE_1_FAST_THROTTLE   MIXER_Q15(0.75)
+#define GAMEPAD_MODE_1_ARC_CURVATURE   MIXER_Q14(0.5)
 
 //==============================================================================
 // Freertos
 
 typedef enum TASKS {
-    TASK_ROBOKID, TASK_DRIVE_MOTORS, TASK_READ_SENSORS, TASK_DISPLAY,
+    TASK_ROBOKID, TASK_DRIVE_MOTORS, TASK_MOTION, TASK_READ_SENSORS, TASK_DISPLAY,
     TASK_READ_GAMEPAD, TASK_SOUNDER, TASK_ERROR, TASK_SERIAL_OUTPUT, 
     TASK_LOG, TASK_BLINK
 } task_t;
@@ -407,6 +552,9 @@ typedef enum TASKS {
 #define     NOS_TASKS   (TASK_BLINK + 1)
 
 #define     TASK_READ_SENSORS_FREQUENCY                 50  // Hz
+#if (TASK_READ_SENSORS_FREQUENCY != ODOMETRY_FREQUENCY)
+    #error "Odometry is integrated by the sensor task : ODOMETRY_FREQUENCY must match"
+#endif
 #define     TASK_READ_SENSORS_FREQUENCY_TICK_COUNT      ((1000/TASK_READ_SENSORS_FREQUENCY) * portTICK_PERIOD_MS)
 
 #define     TASK_DISPLAY_LCD_FREQUENCY                  10  // Hz
@@ -422,7 +570,14 @@ typedef enum TASKS {
 #define     TASK_LOG_FREQUENCY                          0.1  //HZ
 #define     TASK_LOG_FREQUENCY_TICK_COUNT               (10000 * portTICK_PERIOD_MS)
 
+#define     TASK_MOTION_FREQUENCY                       50  // Hz
+#if (TASK_MOTION_FREQUENCY != MOTION_FREQUENCY)
+    #error "Motion speed profile is tuned for MOTION_FREQUENCY : must match"
+#endif
+#define     TASK_MOTION_FREQUENCY_TICK_COUNT            ((1000/TASK_MOTION_FREQUENCY) * portTICK_PERIOD_MS)
+
 #define     MOTOR_CMD_QUEUE_LENGTH          8
+#define     MOTION_QUEUE_LENGTH             16
 #define     ERROR_MESSAGE_QUEUE_LENGTH      8
 
 //==============================================================================
@@ -500,33 +655,91 @@ struct gamepad_data_s  {
     uint8_t     button_X, button_Y, button_A, button_B;
     uint8_t     button_L, button_R;
     uint8_t     button_START, button_SELECT;
+    uint32_t    generation;             // incremented on every change
 } ;
 
 struct system_status_s {
     error_codes_te     error_state;
+    uint32_t           generation;      // incremented on every new error
 } ;
 
 struct __attribute__((__packed__)) motor_cmd_packet_s {
     motor_cmd_t     cmd;
     int8_t          param1, param2, param3;
+    uint32_t        timestamp_us;       // set by send_motor_cmd()
+    uint16_t        deadline_ms;        // MOTOR_CMD_NO_DEADLINE or max queue time
+} ;
+
+struct motor_watchdog_data_s {
+    uint32_t    trip_count;
+    uint32_t    last_reaction_us;   // time from last command to brake
+    uint32_t    max_reaction_us;
+} ;
+
+struct emergency_stop_data_s {
+    uint32_t    stop_count;
+    uint32_t    last_latency_us;    // time from request (e.g. button press) to PWM change
+    uint32_t    max_latency_us;
+    uint32_t    stop_time_us;       // MOVE commands sent before this are discarded
+} ;
+
+struct motor_cmd_stats_s {
+    uint32_t    commands_received;
+    uint32_t    commands_expired;
+    uint32_t    max_latency_us;
+    uint32_t    latency_histogram[MOTOR_CMD_LATENCY_BINS];
 } ;
 
 struct motor_data_s {
     direction_t     motor_state;
-    uint8_t         pwm_width;
+    int8_t          pwm_width;      // -100% to +100%
     bool            flip;
 } ;
 
 struct  push_button_data_s {
     bool      switch_value;
     uint32_t  on_time;
+    uint32_t  press_time_us;    // time_us_32() when last press was seen
 };
 
+struct motion_primitive_s {
+    motion_type_te  type;
+    int16_t         distance_mm;        // DRIVE : -ve is backwards
+    int16_t         angle_degrees;      // ROTATE and ARC
+    int16_t         radius_mm;          // ARC
+    int16_t         speed_mm_s;
+} ;
+
+struct motion_data_s {
+    motion_state_te     state;
+    motion_type_te      type;
+    uint32_t            primitives_completed;
+    uint32_t            primitives_aborted;
+    uint32_t            expected_time_ms;   // of last completed primitive
+    uint32_t            actual_time_ms;
+} ;
+
 struct vehicle_data_s {
     vehicle_state_t     vehicle_state;
     uint32_t            speed;
 };
 
+/**
+ * @brief Dead-reckoning estimate of vehicle position
+ * 
+ * Heading is a binary angle : 65536 = 360 degrees, 0 = along X axis,
+ * positive angles are anti-clockwise (turning left).
+ */
+struct odometry_data_s {
+    int32_t     x_mm, y_mm;
+    uint16_t    heading;            // binary angle
+    int16_t     heading_degrees;    // 0 to 359
+    int16_t     left_speed_mm_s, right_speed_mm_s;
+    int16_t     speed_mm_s;         // speed of vehicle centre
+    uint32_t    distance_mm;        // total distance travelled
+    uint32_t    update_count;
+};
+
 struct LED_data_s {
     uint8_t         pin_number;
     LED_state_te    state;
@@ -571,6 +784,61 @@ struct system_modes_s {
 
 struct string_buffer_s {
     uint32_t    buffer_index;
+    uint32_t    length;         // 0 : '\0' terminated string, otherwise number of binary bytes
+};
+
+//==============================================================================
+// Binary telemetry (telemetry.c, decoded by tools/telemetry_decoder.py)
+//
+// Frame before COBS encoding : record type, sequence number, time (uS),
+// payload, CRC-16/CCITT of all preceding bytes.  Multi-byte values are
+// little endian.  Each COBS encoded frame is followed by a 0x00 delimiter.
+
+#define     TELEMETRY_HEADER_SIZE       6
+#define     TELEMETRY_CRC_SIZE          2
+#define     TELEMETRY_MAX_PAYLOAD       64
+#define     TELEMETRY_MAX_FRAME         (TELEMETRY_HEADER_SIZE + TELEMETRY_MAX_PAYLOAD + TELEMETRY_CRC_SIZE)
+#define     TELEMETRY_TASK_STATS_MS     1000
+
+#if ((TELEMETRY_MAX_FRAME + (TELEMETRY_MAX_FRAME / 254) + 2) > STRING_LENGTH)
+    #error "Encoded telemetry frame does not fit in a print buffer"
+#endif
+
+typedef enum {
+    TELEMETRY_ANALOGUE          = 1,    // processed value of all CD4051 channels
+    TELEMETRY_ANALOGUE_CHANNEL  = 2,    // raw data of one CD4051 channel
+    TELEMETRY_MOTOR             = 3,    // motor state and command counts
+    TELEMETRY_TASK              = 4,    // task stack and execution time
+} telemetry_record_te;
+
+struct __attribute__((packed)) telemetry_analogue_s {
+    uint16_t    value[NOS_CD4051_CHANNELS];
+};
+
+struct __attribute__((packed)) telemetry_analogue_channel_s {
+    uint8_t     channel;
+    uint16_t    raw;
+    uint16_t    value;
+    uint16_t    glitch_threshold;
+    uint8_t     glitch_count;
+    uint16_t    max_delta;
+};
+
+struct __attribute__((packed)) telemetry_motor_s {
+    struct __attribute__((packed)) {
+        uint8_t     state;
+        int8_t      pwm_width;
+    } motor[NOS_ROBOKID_MOTORS];
+    uint32_t    commands_received;
+    uint32_t    commands_expired;
+};
+
+struct __attribute__((packed)) telemetry_task_s {
+    uint8_t     task;
+    uint32_t    stack_high_water;
+    uint32_t    last_exec_time;
+    uint32_t    lowest_exec_time;
+    uint32_t    highest_exec_time;
 };
 
 //==============================================================================
@@ -645,11 +913,18 @@ struct system_IO_data_s  {
     struct task_data_s                  task_data[NOS_TASKS];
     uint16_t                            system_voltage;
     struct motor_data_s                 motor_data[NOS_ROBOKID_MOTORS];
+    struct motor_cmd_stats_s            motor_cmd_stats;
     struct LED_data_s                   LED_data[NOS_ROBOKID_LEDS];
     struct push_button_data_s           push_button_data[NOS_ROBOKID_PUSH_BUTTONS];
     struct analogue_global_data_s       analogue_global_data[NOS_CD4051_CHANNELS];
+    struct {
+        uint8_t     icon;                                   // BATTERY_FULL to BATTERY_EMPTY
+        uint32_t    generation;                             // incremented when icon changes
+    } battery_data;
     struct line_sensor_data_s           line_sensor_data[NOS_ROBOKID_LINE_SENSORS];
     struct vehicle_data_s               vehicle_data;
+    struct odometry_data_s              odometry_data;
+    struct motion_data_s                motion_data;
 } ;
 
 //==============================================================================
@@ -665,14 +940,110 @@ struct LCD_scroll_data_s {
     uint8_t     first_LCD_row;
     uint8_t     scroll_delay;       // in units of LCD task (typ 100mS)
     uint8_t     scroll_delay_count;
+    bool        restart;            // show first strings without waiting for delay
+    bool        hw_step;            // rows moved up one : rotate display (SSD1306_HW_SCROLL)
     char        string_data[MAX_SCROLL_STRINGS][MAX_SSD1306_STRING_LENGTH];     // pointer  to list of strings
 } ;
 
 struct LCD_row_data_s {
     bool    dirty_bit;
     uint8_t font;
-    char    row_string[16];
+    char    row_string[LCD_ROW_STRING_LENGTH];
     bool    invert;
+    bool    refresh;            // rewrite all characters, not just changed ones
+} ;
+
+struct SSD1306_stats_s {
+    uint32_t    bytes_sent;         // control + data bytes on bus
+    uint32_t    transactions;       // I2C start/stop or SPI CS cycles
+    uint32_t    flush_count;
+    uint32_t    last_flush_us;
+    uint32_t    max_flush_us;
+    uint32_t    dma_timeouts;
+    uint32_t    bus_aborts;
+    uint32_t    glyph_cache_hits;
+    uint32_t    glyph_cache_misses;
+    uint32_t    i2c_baudrate;       // actual bus rate
+    uint32_t    speed_fallbacks;
+    uint32_t    icon_row_builds;
+    uint32_t    icon_rows_suppressed;   // icon row not rebuilt : no input changed
+    uint32_t    scroll_steps;       // scroll area steps by start line
+    uint32_t    frame_cost_us;      // display update time (render and flush), smoothed
+    uint32_t    frame_time_us;      // total display update time : budget use
+    uint32_t    update_interval_ms; // current minimum interval between updates
+} ;
+
+struct strip_chart_column_s {
+    uint8_t     min[STRIP_CHART_MAX_CHANNELS];      // 0 to 100%
+    uint8_t     max[STRIP_CHART_MAX_CHANNELS];      // min > max : column empty
+} ;
+
+struct strip_chart_s {
+    uint8_t                     nos_channels;
+    uint8_t                     decimation;
+    uint8_t                     sample_count;       // samples in current column
+    uint8_t                     cursor;             // next column to be written
+    uint8_t                     last[STRIP_CHART_MAX_CHANNELS];    // joins adjacent columns
+    struct strip_chart_column_s current;
+    struct strip_chart_column_s column[STRIP_CHART_NOS_COLUMNS];    // ring buffer
+} ;
+
+struct widget_s {
+    widget_type_te  type;
+    int16_t         x, y;           // top left corner, pixels
+    uint8_t         font;           // LABEL, VALUE and ICON
+    uint8_t         size;           // VALUE : characters in field, BAR : width in pixels
+    uint8_t         height;         // BAR : pixels
+    bool            invert;         // LABEL and VALUE
+    const char      *text;          // LABEL : text, VALUE : printf format of value
+    int32_t         min, max;       // BAR : value range
+} ;
+
+struct widget_state_s {
+    int32_t     value;
+    int32_t     drawn_value;        // value on display (BAR : redraw changed span only)
+    bool        dirty;
+    int16_t     x2, y2;             // cached bottom right corner of bounding box
+} ;
+
+struct sprite_image_s {
+    const uint8_t   *pixels;        // page-major, as display RAM
+    const uint8_t   *mask;          // 1 = sprite pixel, 0 = background shows through
+} ;
+
+struct sprite_animation_s {
+    uint8_t                         width, height;      // pixels, all frames
+    uint8_t                         nos_frames;
+    uint16_t                        frame_ms;           // time each frame is shown
+    const struct sprite_image_s     *frames;
+} ;
+
+struct sprite_s {
+    const struct sprite_animation_s *animation;
+    int16_t     x, y;                   // position to be drawn
+    uint8_t     frame;
+    TickType_t  next_frame_time;
+    bool        changed;                // moved, or started : redraw at next update
+    bool        drawn;
+    int16_t     drawn_x, drawn_y;       // position of saved background
+    uint8_t     background[SPRITE_BACKGROUND_SIZE];
+} ;
+
+struct widget_screen_s {
+    int16_t                 top, height;    // rows of display owned by screen : cleared when shown
+    uint8_t                 nos_widgets;
+    const struct widget_s   *widgets;
+    struct widget_state_s   *state;         // nos_widgets entries
+} ;
+
+struct font_metrics_s {
+    uint8_t         width;          // pixels
+    uint8_t         height;         // pixels
+    uint8_t         nos_pages;      // height / 8
+    uint8_t         first_char;
+    uint8_t         last_char;
+    uint16_t        glyph_size;     // bytes per glyph
+    const uint8_t   *glyphs;        // page-major glyph data (after header)
 } ;
 
 struct font_data_s {
@@ -725,6 +1096,7 @@ extern void Task_read_sensors(void *p);
 extern void Task_read_gamepad(void *p);
 extern void Task_display_LCD(void *p);
 extern void Task_drive_motors(void *p);
+extern void Task_motion(void *p);
 extern void Task_error(void *p);
 extern void Task_sounder (void *p);
 extern void Task_serial_output(void *p);
@@ -736,6 +1108,7 @@ extern  TaskHandle_t taskhndl_Task_read_sensors;
 extern  TaskHandle_t taskhndl_Task_read_gamepad;
 extern  TaskHandle_t taskhndl_Task_display_LCD;
 extern  TaskHandle_t taskhndl_Task_drive_motors;
+extern  TaskHandle_t taskhndl_Task_motion;
 extern  TaskHandle_t taskhndl_Task_error;
 extern  TaskHandle_t taskhndl_Task_sounder;
 extern  TaskHandle_t taskhndl_Task_serial_output;
@@ -749,11 +1122,13 @@ extern SemaphoreHandle_t semaphore_gamepad_data;
 extern SemaphoreHandle_t semaphore_tune_data;
 
 extern QueueHandle_t queue_motor_cmds;                  // queues
+extern QueueHandle_t queue_motion_primitives;
 extern QueueHandle_t queue_error_messages;
 extern QueueHandle_t queue_print_string_buffers;
 extern QueueHandle_t queue_free_buffers;
 
 extern EventGroupHandle_t eventgroup_push_buttons;      // event groups
+extern EventGroupHandle_t eventgroup_motion;
 
 extern struct error_message_s     error_message_log[LOG_SIZE];
 
@@ -763,12 +1138,21 @@ extern const unsigned char Terminal_9x16[];
 extern const unsigned char robokid_LCD_icons_font_15x16[];
 
 extern const uint8_t *font_table[];
+extern const struct font_metrics_s font_metrics[];
 extern const unsigned char Terminal_12x16[];
 extern const unsigned char Font_6x8[];
 extern const unsigned char Segment_25x40[];
 extern const unsigned char truck_bmp[1024];
 
+extern const unsigned char Terminal_9x16_page_major[];
+extern const unsigned char robokid_LCD_icons_font_15x16_page_major[];
+extern const unsigned char Terminal_12x16_page_major[];
+extern const unsigned char Font_6x8_page_major[];
+extern const unsigned char Segment_25x40_page_major[];
+
 extern struct LCD_row_data_s  LCD_row_data[];
+extern LCD_class_te            LCD_refresh_class;
+extern struct SSD1306_stats_s SSD1306_stats;
 extern struct LCD_scroll_data_s   LCD_scroll_data;
 
 extern char print_string_buffers[NOS_PRINT_STRING_BUFFERS][STRING_LENGTH];
@@ -0,0 +1,18 @@
+/**
+ * @file    telemetry.h
+ * @author  Jim Herd
+ * @brief   Binary framed telemetry on serial output
+ */
+
+#ifndef __TELEMETRY_H__
+#define __TELEMETRY_H__
+
+#include    "system.h"
+
+error_codes_te  telemetry_send(telemetry_record_te type, const void *payload, uint32_t length);
+void            telemetry_send_analogue(void);
+void            telemetry_send_analogue_channel(uint8_t channel);
+void            telemetry_send_motor(void);
+void            telemetry_send_tasks(void);
+
+#endif  /* __TELEMETRY_H__ */
@@ -0,0 +1,18 @@
+/**
+ * @file    widgets.h
+ * @author  Jim Herd
+ * @brief   Retained-mode widgets (labels, value fields, bars, icons) on SSD1306 display
+ */
+
+#ifndef __WIDGETS_H__
+#define __WIDGETS_H__
+
+#include    "system.h"
+
+#define     NOS_WIDGETS(table)      (sizeof(table) / sizeof(table[0]))
+
+void    widget_screen_show(struct widget_screen_s *screen);
+void    widget_set_value(struct widget_screen_s *screen, uint8_t index, int32_t value);
+void    widget_screen_update(struct widget_screen_s *screen);
+
+#endif  /* __WIDGETS_H__ */
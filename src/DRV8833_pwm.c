@@ -16,11 +16,27 @@
 
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "queue.h"
 
 struct motor_data_s    temp_motor_data;
 
 uint8_t  LM_slice_num, RM_slice_num;
 
+//==============================================================================
+// Watchdog data : shared with timer interrupt
+//==============================================================================
+
+static repeating_timer_t                motor_watchdog_timer;
+static volatile uint32_t                last_command_us;
+static volatile bool                    motor_running[NOS_ROBOKID_MOTORS];
+static volatile struct motor_watchdog_data_s   motor_watchdog_data;
+
+//
+// Incremented by every direct brake (emergency stop or watchdog).  A MOVE
+// that started before a brake is not written to the PWM hardware.
+//
+static volatile uint32_t                brake_generation;
+
 //==============================================================================
 void DRV8833_init(void )
 {
@@ -80,7 +96,8 @@ motor_cmd_t     left_motor_state, right_motor_state;
 uint8_t         pwm_slice;
 direction_t     new_direction;
 uint32_t        DRV8833_in1, DRV8833_in2, temp;
-bool            zero_cross_over;
+uint32_t        generation;
+bool            zero_cross_over, braked;
 error_codes_te   error;
 
     // check parameters
@@ -103,6 +120,14 @@ error_codes_te   error;
         }  
     }
 
+    // a stopped motor has no speed, whatever width the caller passed :
+    // the logged width is used by odometry
+
+    if (command != MOVE) {
+        pwm_width = 0;
+    }
+    generation = brake_generation;
+
     // get motor data
 
     xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
@@ -182,10 +207,21 @@ error_codes_te   error;
         }
     }
 
-    // output in1/in2 motor control signals
+    // output in1/in2 motor control signals, unless a direct brake has
+    // happened since this command started (e.g. during zero cross over
+    // delay) : the brake holds and the motor is logged as stopped
 
-    pwm_set_chan_level(pwm_slice, PWM_CHAN_A, DRV8833_in1);
-    pwm_set_chan_level(pwm_slice, PWM_CHAN_B, DRV8833_in2);
+    taskENTER_CRITICAL();
+        braked = ((command == MOVE) && (brake_generation != generation));
+        if (braked == false) {
+            pwm_set_chan_level(pwm_slice, PWM_CHAN_A, DRV8833_in1);
+            pwm_set_chan_level(pwm_slice, PWM_CHAN_B, DRV8833_in2);
+        }
+    taskEXIT_CRITICAL();
+    if (braked == true) {
+        pwm_width     = 0;
+        new_direction = OFF;
+    }
  
     // log state
 
@@ -201,6 +237,114 @@ error_codes_te   error;
     return OK;
 }
 
+//==============================================================================
+/**
+ * @brief   Brake both motors by direct write to PWM hardware
+ * 
+ * @note    No delays, no mutex, safe to call from an interrupt.
+ *          motor_data is not updated; the caller should follow up
+ *          with MOTOR_BRAKE commands to the motor task.  A MOVE already
+ *          in progress in DRV8833_set_motor() is cancelled.
+ */
+void DRV8833_brake_all(void)
+{
+    brake_generation++;
+    pwm_set_chan_level(LM_slice_num, PWM_CHAN_A, MOTOR_PWM_MAX_COUNT);
+    pwm_set_chan_level(LM_slice_num, PWM_CHAN_B, MOTOR_PWM_MAX_COUNT);
+    pwm_set_chan_level(RM_slice_num, PWM_CHAN_A, MOTOR_PWM_MAX_COUNT);
+    pwm_set_chan_level(RM_slice_num, PWM_CHAN_B, MOTOR_PWM_MAX_COUNT);
+}
+
+//==============================================================================
+/**
+ * @brief   Watchdog check : runs in timer interrupt
+ * 
+ * @note    Motors are braked directly so that a stalled task cannot delay
+ *          the stop. Brake commands are then put at the front of the motor
+ *          queue so that the motor task records the new state.
+ */
+static bool motor_watchdog_callback(repeating_timer_t *rt)
+{
+uint32_t                    silence_us;
+struct motor_cmd_packet_s   brake_cmd;
+BaseType_t                  xHigherPriorityTaskWoken;
+
+    silence_us = time_us_32() - last_command_us;
+    if (motor_watchdog_expired((motor_running[LEFT_MOTOR] || motor_running[RIGHT_MOTOR]), silence_us) == false) {
+        return true;
+    }
+
+    DRV8833_brake_all();
+    motor_running[LEFT_MOTOR]  = false;
+    motor_running[RIGHT_MOTOR] = false;
+
+    motor_watchdog_data.trip_count++;
+    motor_watchdog_data.last_reaction_us = silence_us;
+    if (silence_us > motor_watchdog_data.max_reaction_us) {
+        motor_watchdog_data.max_reaction_us = silence_us;
+    }
+
+    xHigherPriorityTaskWoken = pdFALSE;
+    brake_cmd.cmd          = MOTOR_BRAKE;
+    brake_cmd.param2       = 0;
+    brake_cmd.param3       = 0;
+    brake_cmd.timestamp_us = time_us_32();
+    brake_cmd.deadline_ms  = MOTOR_CMD_NO_DEADLINE;
+    brake_cmd.param1       = LEFT_MOTOR;
+    xQueueSendToFrontFromISR(queue_motor_cmds, &brake_cmd, &xHigherPriorityTaskWoken);
+    brake_cmd.param1       = RIGHT_MOTOR;
+    xQueueSendToFrontFromISR(queue_motor_cmds, &brake_cmd, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+
+    return true;
+}
+
+//==============================================================================
+/**
+ * @brief   Start motor watchdog timer interrupt
+ */
+void motor_watchdog_init(void)
+{
+    last_command_us = time_us_32();
+    motor_running[LEFT_MOTOR]  = false;
+    motor_running[RIGHT_MOTOR] = false;
+    motor_watchdog_data.trip_count       = 0;
+    motor_watchdog_data.last_reaction_us = 0;
+    motor_watchdog_data.max_reaction_us  = 0;
+    add_repeating_timer_ms(MOTOR_WATCHDOG_CHECK_MS, motor_watchdog_callback, NULL, &motor_watchdog_timer);
+}
+
+//==============================================================================
+/**
+ * @brief   Feed watchdog with a command that has been applied to a motor
+ * 
+ * @param motor_number  LEFT_MOTOR or RIGHT_MOTOR
+ * @param cmd           MOTOR_OFF, MOTOR_BRAKE, or MOVE
+ * @param pwm_width     -100% to +100%
+ */
+void motor_watchdog_feed(motor_t motor_number, motor_cmd_t cmd, int8_t pwm_width)
+{
+    taskENTER_CRITICAL();
+        last_command_us = time_us_32();
+        motor_running[motor_number] = ((cmd == MOVE) && (pwm_width != 0));
+    taskEXIT_CRITICAL();
+}
+
+//==============================================================================
+/**
+ * @brief   Get copy of watchdog statistics
+ * 
+ * @param data_pt   pointer to destination structure
+ */
+void motor_watchdog_get_data(struct motor_watchdog_data_s *data_pt)
+{
+    taskENTER_CRITICAL();
+        data_pt->trip_count       = motor_watchdog_data.trip_count;
+        data_pt->last_reaction_us = motor_watchdog_data.last_reaction_us;
+        data_pt->max_reaction_us  = motor_watchdog_data.max_reaction_us;
+    taskEXIT_CRITICAL();
+}
+
 //==============================================================================
 // vehicle_stop : set both motor to brake
 // ============
@@ -224,27 +368,27 @@ error_codes_te error;
 //      Uses the state of each motor to define the state of the vehicle
 //      -              STOPPED, MOVING_FORWARD, MOVING_BACKWARD, TURNING_LEFT, TURNING_RIGHT
 //  7-seg didplay         0           1                 2              3            4
+//
+//      Speed is the odometry estimate of the vehicle centre speed.
+//      Caller must hold "semaphore_system_IO_data".
 // 
 void set_vehicle_state(void) 
 {
-
- //   uint8_t LM_state = motor_data[LEFT_MOTOR].motor_state;
- //   uint8_t RM_state = motor_data[RIGHT_MOTOR].motor_state;
-
-    // if ((LM_state == MOTOR_FORWARD) && (RM_state == MOTOR_FORWARD)) { 
-    //     vehicle_data.vehicle_state = MOVING_FORWARD;
-    //     vehicle_data.speed = 0;
-    // } else if ((LM_state == MOTOR_BACKWARD) && (RM_state == MOTOR_BACKWARD)) {
-    //     vehicle_data.vehicle_state = MOVING_BACKWARD;
-    //     vehicle_data.speed = 0;
-    // } else if ((LM_state == MOTOR_BACKWARD) && (RM_state == MOTOR_FORWARD)) {
-    //     vehicle_data.vehicle_state = TURNING_LEFT;
-    //     vehicle_data.speed = 0;
-    // } else if ((LM_state == MOTOR_FORWARD) && (RM_state == MOTOR_BACKWARD)) {
-    //     vehicle_data.vehicle_state = TURNING_RIGHT;
-    //     vehicle_data.speed = 0;
-    // } else {
-    //     vehicle_data.vehicle_state = STOPPED;
-    //     vehicle_data.speed = 0;
-    // }
+direction_t LM_state = system_IO_data.motor_data[LEFT_MOTOR].motor_state;
+direction_t RM_state = system_IO_data.motor_data[RIGHT_MOTOR].motor_state;
+
+    if ((LM_state == FORWARD) && (RM_state == FORWARD)) { 
+        system_IO_data.vehicle_data.vehicle_state = MOVING_FORWARD;
+    } else if ((LM_state == BACKWARD) && (RM_state == BACKWARD)) {
+        system_IO_data.vehicle_data.vehicle_state = MOVING_BACKWARD;
+    } else if ((LM_state != FORWARD) && (RM_state == FORWARD)) {
+        system_IO_data.vehicle_data.vehicle_state = TURNING_LEFT;
+    } else if ((LM_state == FORWARD) && (RM_state != FORWARD)) {
+        system_IO_data.vehicle_data.vehicle_state = TURNING_RIGHT;
+    } else if ((LM_state == BACKWARD) || (RM_state == BACKWARD)) {
+        system_IO_data.vehicle_data.vehicle_state = MOVING_BACKWARD;
+    } else {
+        system_IO_data.vehicle_data.vehicle_state = STOPPED;
+    }
+    system_IO_data.vehicle_data.speed = abs(system_IO_data.odometry_data.speed_mm_s);
 }
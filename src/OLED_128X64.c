@@ -21,6 +21,7 @@
 #include "OLED_128X64.h"
 
 #include "system.h"
+#include "SSD1306.h"
 
 #include "font.h"
 #include "bitmap.h"
@@ -95,6 +96,8 @@ const uint8_t init_sequence [] = {
         ENABLE_CHARGE_PUMP,         // Set DC-DC enable
 };
 
+const uint32_t init_sequence_length = sizeof(init_sequence);
+
 //==============================================================================
 // Initializes the OLED module.
 //==============================================================================
@@ -123,9 +126,14 @@ void  SSD1306_init(void){
     gpio_set_function(SSD1306_I2C_SCL_PIN, GPIO_FUNC_I2C);
     gpio_pull_up(SSD1306_I2C_SDA_PIN);
     gpio_pull_up(SSD1306_I2C_SCL_PIN);
+    SSD1306_dma_init();
+    SSD1306_i2c_probe();
 #endif
 
     SSD1306_command_seq(init_sequence, sizeof(init_sequence));
+#ifdef SSD1306_HW_SCROLL
+    SSD1306_scroll_area_reset();
+#endif
 
     Oled_Delay();
 
@@ -157,6 +165,7 @@ void  SSD1306_init(void){
     SSD1306_FillScreen(0x00);                  // Clear screen */
 
     SSD1306_FillScreen(0x00);                  // Clear screen */
+    SSD1306_flush();
     SSD1306_command(SET_DISPLAY_ON);           // Set Display ON
 }
 
@@ -191,7 +200,6 @@ void  Oled_Reset(void)
  */
 void  SSD1306_command(const uint8_t cmd)
 {
-
 #ifdef SSD1306_INTERFACE_SPI
     gpio_put(OLED_CS, 1);
     gpio_put(OLED_DC, 0);
@@ -204,17 +212,18 @@ void  SSD1306_command(const uint8_t cmd)
     // I2C write process expects a control byte followed by data
     // this "data" can be a command or data to follow up a command
     // Co = 1, D/C = 0 => the driver expects a command
-    uint8_t buf[2] = {0x80, cmd};
-    int reply;
-    reply = i2c_write_blocking(I2C_PORT, SSD1306_ADDRESS, buf, 2, false);
-    if (reply == PICO_ERROR_GENERIC ) {
-        __breakpoint;
-    }
+    SSD1306_i2c_write(0x80, &cmd, 1);
+#endif
+#ifdef SSD1306_INTERFACE_SPI
+    SSD1306_stats.bytes_sent += 1;
+    SSD1306_stats.transactions++;
 #endif
-
 }
 //==============================================================================
-// Write a single command.
+// Write a sequence of commands.
+//
+// On I2C, a single control byte (Co = 0, D/C = 0) is followed by the
+// complete command stream in one transaction.
 //==============================================================================
 void  SSD1306_command_seq(const uint8_t *cmd_seq, uint32_t len)
 {
@@ -224,12 +233,12 @@ void  SSD1306_command_seq(const uint8_t *cmd_seq, uint32_t len)
     gpio_put(OLED_CS, 0);
     spi_write_blocking(SPI_PORT, cmd_seq, len);
     gpio_put(OLED_CS, 1);
+    SSD1306_stats.bytes_sent += len;
+    SSD1306_stats.transactions++;
 #endif
 
 #ifdef SSD1306_INTERFACE_I2C
-    for (uint32_t i = 0; i < len; i++) {
-        SSD1306_command(cmd_seq[i]);
-    }
+    SSD1306_i2c_write(SSD1306_CONTROL_COMMAND_STREAM, cmd_seq, len);
 #endif
 }
 
@@ -244,12 +253,13 @@ void  SSD1306_WriteRam(uint8_t dat)
     gpio_put(OLED_CS, 0);
     spi_write_blocking(SPI_PORT, &dat, 1);
     gpio_put(OLED_CS, 1);   
+    SSD1306_stats.bytes_sent += 1;
+    SSD1306_stats.transactions++;
 #endif
 
 #ifdef SSD1306_INTERFACE_I2C
     // Co = 0, D/C = 1 => the driver expects data to be written to RAM
-    uint8_t buf[2] = {0x40, dat};
-    i2c_write_blocking(I2C_PORT, SSD1306_ADDRESS, buf, 2, false);
+    SSD1306_i2c_write(SSD1306_CONTROL_DATA_STREAM, &dat, 1);
 #endif
 }
 
@@ -313,16 +323,17 @@ uint x_seg, y_pag;
     for(i = 0; i < width; i++) {
         y_pag = pag;
         for(j = 0; j < height; j++) {
-            if(x_seg < 128) {
-                SSD1306_SetPointer(x_seg, y_pag);
-                SSD1306_WriteRam(*font);
-                SSD1306_RAM[x_seg + (y_pag * 128)] = *font;  // keep copy
+            if((x_seg < 128) && (y_pag < 8)) {
+                SSD1306_RAM[x_seg + (y_pag * 128)] = *font;
             }
             y_pag++;
             font++;
         }
         x_seg++;
     }
+    for(j = 0; j < height; j++) {
+        SSD1306_mark_dirty(pag + j, seg, seg + width - 1);
+    }
 }
 
 //==============================================================================
@@ -378,16 +389,10 @@ uint i;
         cnt_character++;
         cnt_width = 0; 
     }
-    SSD1306_SetPointer(0, 0);
-    for(i = 0; i < 127; i++) {
-        SSD1306_RAM[i] = SSD1306_RAM[i+1];
-        SSD1306_WriteRam(SSD1306_RAM[i]);
-    } 
-    SSD1306_SetPointer(0, 1);
-    for(i = 128; i < 255; i++) {
-        SSD1306_RAM[i] = SSD1306_RAM[i+1];
-        SSD1306_WriteRam(SSD1306_RAM[i]);
-    }
+    memmove(&SSD1306_RAM[0], &SSD1306_RAM[1], 127);
+    memmove(&SSD1306_RAM[128], &SSD1306_RAM[129], 127);
+    SSD1306_mark_dirty(0, 0, 127);
+    SSD1306_mark_dirty(1, 0, 127);
 }
 
 //==============================================================================
@@ -410,16 +415,10 @@ uint i;
         cnt_character++;
         cnt_width = 0; 
     }
-    SSD1306_SetPointer(0, 0);
-    for(i = 0; i < 127; i++) {
-        SSD1306_RAM[i] = SSD1306_RAM[i+1];
-        SSD1306_WriteRam(SSD1306_RAM[i]);
-    } 
-    SSD1306_SetPointer(0, 1);
-    for(i = 128; i < 255; i++) {
-        SSD1306_RAM[i] = SSD1306_RAM[i+1];
-        SSD1306_WriteRam(SSD1306_RAM[i]);
-    }
+    memmove(&SSD1306_RAM[0], &SSD1306_RAM[1], 127);
+    memmove(&SSD1306_RAM[128], &SSD1306_RAM[129], 127);
+    SSD1306_mark_dirty(0, 0, 127);
+    SSD1306_mark_dirty(1, 0, 127);
 }
 
 //==============================================================================
@@ -438,17 +437,8 @@ void  Oled_ResetScroll(void)
 //==============================================================================
 void  SSD1306_FillScreen(uint8_t pattern)
 {
-uint8_t i, j;
-uint k = 0;
-
-    for(i = 0; i < 8; i++) {
-        SSD1306_SetPointer(0, i);
-        for(j = 0; j < 128; j++) {
-            SSD1306_WriteRam(pattern);
-            SSD1306_RAM[k] = pattern;
-            k++;
-        }
-    }
+    memset(SSD1306_RAM, pattern, SSD1306_RAM_SIZE);
+    SSD1306_mark_all_dirty();
 }
 
 //==============================================================================
@@ -457,18 +447,8 @@ uint k = 0;
 //==============================================================================
 void  Oled_Image(const unsigned char *buffer)
 {
-uint8_t i, j;
-uint k = 0;
-
-    for(i = 0; i < 8; i++) {
-        SSD1306_SetPointer(0, i);
-        for(j = 0; j < 128; j++) {
-            SSD1306_WriteRam(*buffer);
-            SSD1306_RAM[k] = *buffer;
-            buffer++;
-            k++;
-        }
-    }
+    memcpy(SSD1306_RAM, buffer, SSD1306_RAM_SIZE);
+    SSD1306_mark_all_dirty();
 }
 
 //==============================================================================
@@ -488,14 +468,13 @@ uint x_seg, y_pag;
     for(i = 0; i < _height / 8; i++) {
         x_seg = seg;
         for(j = 0; j < _width; j++) {
-            if(x_seg < 128) {
-                SSD1306_SetPointer(x_seg, y_pag);
-                SSD1306_WriteRam(*buffer);
+            if((x_seg < 128) && (y_pag < 8)) {
                 SSD1306_RAM[x_seg + (y_pag * 128)] = *buffer;
             }
             buffer++;
             x_seg++;
         }
+        SSD1306_mark_dirty(y_pag, seg, seg + _width - 1);
         y_pag++;
     }          
 }
@@ -515,95 +494,226 @@ uint i, j, k;
         for(j = seg1; j <= seg2; j++) {
             k = j + (i * 128);
             SSD1306_RAM[k] = ~SSD1306_RAM[k];
-            SSD1306_SetPointer(j, i);
-            SSD1306_WriteRam(SSD1306_RAM[k]);
         }
+        SSD1306_mark_dirty(i, seg1, seg2);
+    }
+}
+
+//==============================================================================
+// Graphics primitives.
+//
+// All primitives draw into SSD1306_RAM only and mark the bounding box of
+// the area drawn as dirty; nothing is sent until SSD1306_flush().
+// Coordinates are signed and clipped to the display.
+// color: 1 = set (BLACK), 2 = clear (WHITE), 3 = invert (INVERSE)
+//==============================================================================
+
+static uint32_t plot_count;     // pixels drawn, for benchmarks
+
+//==============================================================================
+// Apply a bit mask to a byte of RAM memory (no clipping, no dirty marking).
+//==============================================================================
+static inline void Oled_PlotMask(uint32_t index, uint8_t mask, uint8_t color)
+{
+    switch(color) {
+       case 1: SSD1306_RAM[index] |=  mask; break;
+       case 2: SSD1306_RAM[index] &= ~mask; break;
+       case 3: SSD1306_RAM[index] ^=  mask; break;
+    }
+}
+
+//==============================================================================
+// Draws a pixel without dirty marking. Used by the primitives below.
+//==============================================================================
+static inline void Oled_PlotPixel(int16_t x, int16_t y, uint8_t color)
+{
+    if((x < 0) || (x > 127) || (y < 0) || (y > 63)) {
+        return;
+    }
+    Oled_PlotMask(x + ((y / 8) * 128), (1 << (y % 8)), color);
+    plot_count++;
+}
+
+//==============================================================================
+// Mark a pixel rectangle as dirty, clipped to the display.
+//==============================================================================
+static void Oled_MarkArea(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
+{
+int16_t page;
+
+    if(x1 < 0) x1 = 0;
+    if(y1 < 0) y1 = 0;
+    if(x2 > 127) x2 = 127;
+    if(y2 > 63) y2 = 63;
+    if((x1 > x2) || (y1 > y2)) {
+        return;
+    }
+    for(page = y1 / 8; page <= y2 / 8; page++) {
+        SSD1306_mark_dirty(page, x1, x2);
     }
 }
 
+//==============================================================================
+// Number of pixels drawn by primitives since power on.
+//==============================================================================
+uint32_t Oled_GetPlotCount(void)
+{
+    return plot_count;
+}
+
 //==============================================================================
 // Draws a Pixel on OLED.
 // x: x position. Valid values: 0..127 
 // y: y position. Valid values: 0..63 
 // color: color parameter. Valid values: 1,2,3 
 //==============================================================================
-void  Oled_Pixel(uint8_t x, uint8_t y, uint8_t color)
+void  Oled_Pixel(int16_t x, int16_t y, uint8_t color)
 {
-    
-    if((x < 0) || (x > 127) || (y < 0) || (y > 63)){
+    if((x < 0) || (x > 127) || (y < 0) || (y > 63)) {
         return;
-    }  
-    SSD1306_SetPointer(x, y/8);    
-    switch(color) {
-       case 1: SSD1306_WriteRam(SSD1306_RAM[x+((y/8)*128)] |=  (1<<(y%8))); break;
-       case 2: SSD1306_WriteRam(SSD1306_RAM[x+((y/8)*128)] &= ~(1<<(y%8))); break;
-       case 3: SSD1306_WriteRam(SSD1306_RAM[x+((y/8)*128)] ^=  (1<<(y%8))); break;
+    }
+    Oled_PlotPixel(x, y, color);
+    SSD1306_mark_dirty(y / 8, x, x);
+}
+
+//==============================================================================
+// Draws a horizontal line : a run of bytes in one page with the same mask.
+// x1, x2: end points (any order)
+// y: row
+//==============================================================================
+void  Oled_HLine(int16_t x1, int16_t x2, int16_t y, uint8_t color)
+{
+int16_t     x, tmp;
+uint32_t    index;
+uint8_t     mask;
+
+    if(x1 > x2) { tmp = x1; x1 = x2; x2 = tmp; }
+    if((y < 0) || (y > 63) || (x2 < 0) || (x1 > 127)) {
+        return;
+    }
+    if(x1 < 0) x1 = 0;
+    if(x2 > 127) x2 = 127;
+    mask  = 1 << (y % 8);
+    index = (y / 8) * 128;
+    for(x = x1; x <= x2; x++) {
+        Oled_PlotMask(index + x, mask, color);
+    }
+    plot_count += (x2 - x1) + 1;
+    SSD1306_mark_dirty(y / 8, x1, x2);
+}
+
+//==============================================================================
+// Draws a vertical line : whole bytes for full pages, masks at the ends.
+// x: column
+// y1, y2: end points (any order)
+//==============================================================================
+void  Oled_VLine(int16_t x, int16_t y1, int16_t y2, uint8_t color)
+{
+int16_t     y, tmp, y_end;
+uint8_t     mask;
+
+    if(y1 > y2) { tmp = y1; y1 = y2; y2 = tmp; }
+    if((x < 0) || (x > 127) || (y2 < 0) || (y1 > 63)) {
+        return;
+    }
+    if(y1 < 0) y1 = 0;
+    if(y2 > 63) y2 = 63;
+    plot_count += (y2 - y1) + 1;
+    for(y = y1; y <= y2; y = y_end + 1) {
+        y_end = (y | 7);                        // last row in this page
+        if(y_end > y2) y_end = y2;
+        mask = (0xFF << (y % 8)) & (0xFF >> (7 - (y_end % 8)));
+        Oled_PlotMask(x + ((y / 8) * 128), mask, color);
+        SSD1306_mark_dirty(y / 8, x, x);
     }
 }
 
 //==============================================================================
 // Draws a Line on OLED.
 //
-// Bresenham algorithm.
+// Bresenham algorithm. Horizontal and vertical lines use span fills.
 // 
-// x1: x coordinate of the line start. Valid values: 0..127
-// y1: y coordinate of the line start. Valid values: 0..63 
-// x2: x coordinate of the line end. Valid values: 0..127 
-// y2: y coordinate of the line end. Valid values: 0..63 
+// x1: x coordinate of the line start.
+// y1: y coordinate of the line start.
+// x2: x coordinate of the line end.
+// y2: y coordinate of the line end.
 // color: color parameter. Valid values: 1,2,3 
 //==============================================================================
-void  Oled_Line(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color)
-{
- uint8_t i;
- uint8_t longest, shortest; 
- uint8_t numerator;
-
-     uint8_t w = x2 - x1;
-     uint8_t h = y2 - y1;
-     uint8_t dx1 = 0, dy1 = 0, dx2 = 0, dy2 = 0;
-
-    if(w < 0) dx1 = -1; else if(w > 0) dx1 = 1;
-    if(h < 0) dy1 = -1; else if(h > 0) dy1 = 1;
-    if(w < 0) dx2 = -1; else if(w > 0) dx2 = 1;
-    if(w < 0) w *= -1;
-    if(h < 0) h *= -1;
-    longest = w; 
-    shortest = h;
-    if(!(longest > shortest)) {//if(w < 0) w *= -1; //if(h < 0) h *= -1; 
-        longest = h; 
-        shortest = w;
-        if(h < 0) dy2 = -1; else if(h > 0) dy2 = 1;
-        dx2 = 0;         
-    }
-    numerator = longest >> 1;
-    for (i = 0; i <= longest; i++) {
-        Oled_Pixel(x1, y1, color);
-        numerator += shortest;
-        if(!(numerator < longest)) {
-            numerator -= longest;
-            x1 += dx1;
-            y1 += dy1;
-        } else {
-            x1 += dx2;
-            y1 += dy2;
+void  Oled_Line(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+int16_t dx, dy, sx, sy, err, e2, x, y;
+
+    if(y1 == y2) {
+        Oled_HLine(x1, x2, y1, color);
+        return;
+    }
+    if(x1 == x2) {
+        Oled_VLine(x1, y1, y2, color);
+        return;
+    }
+    dx = (x2 > x1) ? (x2 - x1) : (x1 - x2);
+    dy = (y2 > y1) ? (y1 - y2) : (y2 - y1);     // negative
+    sx = (x1 < x2) ? 1 : -1;
+    sy = (y1 < y2) ? 1 : -1;
+    err = dx + dy;
+    x = x1;
+    y = y1;
+    for(;;) {
+        Oled_PlotPixel(x, y, color);
+        if((x == x2) && (y == y2)) {
+            break;
         }
+        e2 = 2 * err;
+        if(e2 >= dy) { err += dy; x += sx; }
+        if(e2 <= dx) { err += dx; y += sy; }
     }
+    Oled_MarkArea((x1 < x2) ? x1 : x2, (y1 < y2) ? y1 : y2, (x1 > x2) ? x1 : x2, (y1 > y2) ? y1 : y2);
 }
 
 //==============================================================================
 // Draws a rectangle on Display.
-// x1: x coordinate of the upper left rectangle corner. Valid values: 0..127  
-// y1: y coordinate of the upper left rectangle corner. Valid values: 0..63 
-// x2: x coordinate of the lower right rectangle corner. Valid values: 0..127 
-// y2: y coordinate of the lower right rectangle corner. Valid values: 0..63 
+// x1, y1: one corner.
+// x2, y2: opposite corner (any order).
+// color: color parameter. Valid values: 1,2,3 
+//==============================================================================
+void  Oled_Rectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
+{
+int16_t tmp;
+
+    if(x1 > x2) { tmp = x1; x1 = x2; x2 = tmp; }
+    if(y1 > y2) { tmp = y1; y1 = y2; y2 = tmp; }
+    Oled_HLine(x1, x2, y1, color);
+    if(y2 != y1) {
+        Oled_HLine(x1, x2, y2, color);
+    }
+    if((y2 - y1) > 1) {                         // sides without corners (matters for INVERSE)
+        Oled_VLine(x1, y1 + 1, y2 - 1, color);
+        if(x2 != x1) {
+            Oled_VLine(x2, y1 + 1, y2 - 1, color);
+        }
+    }
+}
+
+//==============================================================================
+// Draws a filled rectangle on Display : one vertical span per column.
+// x1, y1: one corner.
+// x2, y2: opposite corner (any order).
 // color: color parameter. Valid values: 1,2,3 
 //==============================================================================
-void  Oled_Rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t color)
+void  Oled_FillRectangle(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint8_t color)
 {
-    Oled_Line(x1, y1, x2, y1, color);
-    Oled_Line(x1, y2, x2, y2, color);
-    Oled_Line(x1, y1, x1, y2, color);
-    Oled_Line(x2, y1, x2, y2, color);
+int16_t x, tmp;
+
+    if(x1 > x2) { tmp = x1; x1 = x2; x2 = tmp; }
+    if(y1 > y2) { tmp = y1; y1 = y2; y2 = tmp; }
+    if((x2 < 0) || (x1 > 127) || (y2 < 0) || (y1 > 63)) {
+        return;
+    }
+    if(x1 < 0) x1 = 0;
+    if(x2 > 127) x2 = 127;
+    for(x = x1; x <= x2; x++) {
+        Oled_VLine(x, y1, y2, color);
+    }
 }
 
 //==============================================================================
@@ -611,38 +721,118 @@ void  Oled_Rectangle(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t col
 //
 // Midpoint circle algorithm.
 //
-// x1: x coordinate of the circle center. Valid values: 0..127
-// y1: y coordinate of the circle center. Valid values: 0..63
+// x1: x coordinate of the circle center.
+// y1: y coordinate of the circle center.
 // radius: radius size
 // color: color parameter. Valid values: 1,2,3 
 //==============================================================================
-void  Oled_Circle(uint8_t x1, uint8_t y1, uint8_t radius, uint8_t color)
+void  Oled_Circle(int16_t x1, int16_t y1, int16_t radius, uint8_t color)
 {
-    
-     uint8_t x = radius, y = 0;
-     uint8_t radiusError = 1 - x;
+int16_t x = radius, y = 0;
+int16_t radiusError = 1 - x;
 
-    
+    if(radius == 0) {
+        Oled_Pixel(x1, y1, color);
+        return;
+    }
+    while(x >= y) {                             // each pixel drawn once (matters for INVERSE)
+        if(y == 0) {
+            Oled_PlotPixel(x1 + x, y1, color);
+            Oled_PlotPixel(x1 - x, y1, color);
+            Oled_PlotPixel(x1, y1 + x, color);
+            Oled_PlotPixel(x1, y1 - x, color);
+        } else {
+            Oled_PlotPixel(x1 + x, y1 + y, color);
+            Oled_PlotPixel(x1 - x, y1 + y, color);
+            Oled_PlotPixel(x1 + x, y1 - y, color);
+            Oled_PlotPixel(x1 - x, y1 - y, color);
+            if(x != y) {
+                Oled_PlotPixel(x1 + y, y1 + x, color);
+                Oled_PlotPixel(x1 - y, y1 + x, color);
+                Oled_PlotPixel(x1 + y, y1 - x, color);
+                Oled_PlotPixel(x1 - y, y1 - x, color);
+            }
+        }
+        y++;
+        if(radiusError < 0) {
+            radiusError += 2 * y + 1;
+        } else {
+            x--;
+            radiusError += 2 * (y - x + 1);
+        }
+    }
+    Oled_MarkArea(x1 - radius, y1 - radius, x1 + radius, y1 + radius);
+}
+
+//==============================================================================
+// Draws a filled circle on Display : one horizontal span per row.
+// x1, y1: circle center.
+// radius: radius size
+// color: color parameter. Valid values: 1,2,3 
+//==============================================================================
+void  Oled_FillCircle(int16_t x1, int16_t y1, int16_t radius, uint8_t color)
+{
+int16_t x = radius, y = 0, last_y = -1;
+int16_t radiusError = 1 - x;
 
     while(x >= y) {
-        Oled_Pixel(x + x1, y + y1, color);
-        Oled_Pixel(y + x1, x + y1, color);
-        Oled_Pixel(-x + x1, y + y1, color);
-        Oled_Pixel(-y + x1, x + y1, color);
-        Oled_Pixel(-x + x1, -y + y1, color);
-        Oled_Pixel(-y + x1, -x + y1, color);
-        Oled_Pixel(x + x1, -y + y1, color);
-        Oled_Pixel(y + x1, -x + y1, color);
+        if(y != last_y) {
+            Oled_HLine(x1 - x, x1 + x, y1 + y, color);
+            if(y != 0) {
+                Oled_HLine(x1 - x, x1 + x, y1 - y, color);
+            }
+            last_y = y;
+        }
         y++;
-        if(radiusError<0) {
+        if(radiusError < 0) {
             radiusError += 2 * y + 1;
-        } else   {
+        } else {
+            if(x >= y) {                        // rows beyond the 45 degree point
+                Oled_HLine(x1 - (y - 1), x1 + (y - 1), y1 + x, color);
+                Oled_HLine(x1 - (y - 1), x1 + (y - 1), y1 - x, color);
+            }
             x--;
             radiusError += 2 * (y - x + 1);
         }
     }
 }
 
+//==============================================================================
+// Draws a bitmap at any pixel position, clipped to the display.
+// buffer: page-major bitmap (as Oled_Icon), _width x _height pixels
+// x, y: upper left corner
+// Bitmap pixels are copied (set and clear). Height must be a multiple of 8.
+//==============================================================================
+void  Oled_Bitmap(const unsigned char *buffer, int16_t x, int16_t y, uint8_t _width, uint8_t _height)
+{
+int16_t     top_page, page, col;
+uint8_t     shift, data, i, j;
+uint32_t    index;
+
+    top_page = (y >= 0) ? (y / 8) : -((7 - y) / 8);
+    shift    = y - (top_page * 8);
+    for(i = 0; i < (_height / 8); i++) {
+        page = top_page + i;
+        for(j = 0; j < _width; j++) {
+            col = x + j;
+            if((col < 0) || (col > 127)) {
+                continue;
+            }
+            data = buffer[(i * _width) + j];
+            if((page >= 0) && (page < 8)) {
+                index = col + (page * 128);
+                SSD1306_RAM[index] = (SSD1306_RAM[index] & ~(0xFF << shift)) | (data << shift);
+            }
+            if((shift != 0) && ((page + 1) >= 0) && ((page + 1) < 8)) {
+                index = col + ((page + 1) * 128);
+                SSD1306_RAM[index] = (SSD1306_RAM[index] & ~(0xFF >> (8 - shift))) | (data >> (8 - shift));
+            }
+        }
+    }
+    plot_count += _width * _height;
+    Oled_MarkArea(x, y, x + _width - 1, y + _height - 1);
+}
+
 //==============================================================================
 // Sets the scroll. 
 // start_page: Sets the start page. Valid values: 0..7
@@ -722,42 +912,42 @@ char buffer2[20];
     Oled_ConstText("lines", 30, 0);
     for(i=16; i<64; i=i+4) {
         Oled_Line(0, 16, 127, i, BLACK);
-        sleep_ms(500);
+        SSD1306_flush(); sleep_ms(500);
     }
-    sleep_ms(3000);
+    SSD1306_flush(); sleep_ms(3000);
 
     SSD1306_FillScreen(0x00);
     Oled_ConstText("Circles", 10, 0);
     for(i=1; i<16; i=i+3) {
         Oled_Circle(63, 31, i, BLACK);
-        sleep_ms(500);
+        SSD1306_flush(); sleep_ms(500);
     }
-    sleep_ms(3000);
+    SSD1306_flush(); sleep_ms(3000);
 
     SSD1306_FillScreen(0x00);
     Oled_ConstText("Rectangles", 0, 0);
     for(i = 0; i < 15; i = i + 4) {
         Oled_Rectangle(16+i, 16+i, 112-i, 46-i, BLACK);
-        sleep_ms(500);
+        SSD1306_flush(); sleep_ms(500);
     }
-    sleep_ms(3000);
+    SSD1306_flush(); sleep_ms(3000);
 
     SSD1306_FillScreen(0x00);
     Oled_ConstText("  Inverts  ", 0, 0);
     for(i=0; i<8; i++) {
         Oled_InvertRam(0, 0, 127, 7);
-        sleep_ms(1500);
+        SSD1306_flush(); sleep_ms(1500);
     } 
 
-    sleep_ms(1000);
+    SSD1306_flush(); sleep_ms(1000);
     SSD1306_FillScreen(0x00);
     Oled_ConstText("Main Menu", 8, 0);
     Oled_Icon(icon1,20,3,32,32); 
-    Oled_Icon(icon2,72,3,32,32); sleep_ms(3000);
+    Oled_Icon(icon2,72,3,32,32); SSD1306_flush(); sleep_ms(3000);
     Oled_Icon(icon3,20,3,32,32); 
-    Oled_Icon(icon4,72,3,32,32); sleep_ms(3000);
+    Oled_Icon(icon4,72,3,32,32); SSD1306_flush(); sleep_ms(3000);
 
-    sleep_ms(1000);
+    SSD1306_flush(); sleep_ms(1000);
     SSD1306_FillScreen(0x00);
     Oled_ConstText("Fonts", 35, 0);
     for(i=0; i<113; i++) {
@@ -768,19 +958,19 @@ char buffer2[20];
         Oled_Text(buffer2, 90, 3);
         Oled_SetFont(Font_6x8, 6, 8, 32, 127);
         Oled_Text(buffer2, 99, 6);
-        sleep_ms(200);
+        SSD1306_flush(); sleep_ms(200);
     }
 
-    sleep_ms(3500);
+    SSD1306_flush(); sleep_ms(3500);
     Oled_Image(truck_bmp);
 
-    sleep_ms(5000);
+    SSD1306_flush(); sleep_ms(5000);
     SSD1306_FillScreen(0x00);
     Oled_SetFont(Terminal_12x16, 12, 16, 32 ,127);
     Oled_ResetScroll();
     for(k=0; k<500; k++) {
         Oled_ConstTextScroll("This is a new scroll function  ");
-        sleep_ms(50);
+        SSD1306_flush(); sleep_ms(50);
     }
 
     SSD1306_FillScreen(0x00);
@@ -800,7 +990,7 @@ char buffer2[20];
             }
             i=0;
         }
-        sleep_ms(50);
+        SSD1306_flush(); sleep_ms(50);
         i++;
     }
 }
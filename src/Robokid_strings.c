@@ -86,6 +86,13 @@ const char* mode_B_button_data[4] = {
     "D: Exit mode  "  
 };
 
+const char* mode_A_button_data[4] = {
+    "A: Go         ",
+    "B: -----      ",
+    "C: -----      ",
+    "D: Stop       "  
+};
+
 const char* blank_scroll_area[2] = {
     "              ",
     "              ",  
@@ -4,9 +4,16 @@
 #include "pico/binary_info.h"
 #include "hardware/spi.h"
 #include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
 #include "OLED_128X64.h"
 
 #include "system.h"
+#include "SSD1306.h"
+#include "common.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
 
 //#include "font.h"
 //#include "bitmap.h"
@@ -14,6 +21,45 @@
 uint8_t  page_buffer[128];
 
 struct LCD_scroll_data_s   LCD_scroll_data;
+struct SSD1306_stats_s     SSD1306_stats;
+
+//
+// Columns of each page changed since last flush : one bit per column
+//
+#define     DIRTY_MASK_WORDS    (SSD1306_LCDWIDTH / 32)
+
+static uint32_t     dirty_mask[SSD1306_NOS_PAGES][DIRTY_MASK_WORDS];
+
+#define     IS_DIRTY(page, seg)     (dirty_mask[page][(seg) >> 5] & (1UL << ((seg) & 0x1F)))
+
+static uint8_t  flush_buffer[SSD1306_RAM_SIZE];
+
+static uint8_t  i2c_fault_count;        // failed transfers at fast speed
+static bool     resend_all;             // transfer lost : send whole display again
+
+static uint8_t  scroll_rotation;        // text rows the scroll area is moved up by start line
+
+//
+// Copy of bus transactions for the host emulator (tools/ssd1306_emulator.py).
+// Each record is : control byte, length (2 bytes, little endian), data
+//
+static struct {
+    uint8_t     *buffer;
+    uint32_t    size;
+    uint32_t    count;
+    bool        overflow;
+} capture;
+
+#if (SSD1306_GLYPH_CACHE_ENTRIES > 0)
+//
+// Direct mapped cache of glyphs. Character code 0 marks an empty entry
+//
+static struct {
+    uint8_t     font_code;
+    uint8_t     character;
+    uint8_t     glyph[SSD1306_GLYPH_CACHE_MAX_BYTES];
+} glyph_cache[SSD1306_GLYPH_CACHE_ENTRIES];
+#endif
 
 //
 // Table of virtual windows in SSD1306 display
@@ -34,10 +80,49 @@ struct {
         {0, 4, 127, 7}, // window 5 : rows 3 and 4  - info scroll area
 };
 
-// create buffer to hold 128 display bytes to allow a single I2C command
+// I2C DMA transmit : each 16-bit entry is written to the I2C DATA_CMD register
+// (data in bits 0-7, STOP flag on the last entry). Room for a full display
+// of data plus the control byte.
 #ifdef SSD1306_INTERFACE_I2C
-    uint8_t tmp_buffer[SSD1306_LCDWIDTH+1] = {0x40};
+    static uint16_t         dma_buffer[SSD1306_RAM_SIZE + 1];
+    static int              dma_channel;
+    static TaskHandle_t     dma_waiting_task;
+    static volatile bool    dma_aborted;
+#endif
+
+//==============================================================================
+/**
+ * @brief Get address of glyph data in a page-major font
+ * 
+ * @param font_code     Index into table of available fonts
+ * @param index         glyph index (character - first character)
+ * @return const uint8_t* 
+ */
+static const uint8_t *get_glyph(uint8_t font_code, uint8_t index)
+{
+const struct font_metrics_s   *font = &font_metrics[font_code];
+#if (SSD1306_GLYPH_CACHE_ENTRIES > 0)
+uint32_t    entry;
+uint8_t     character;
+
+    if (font->glyph_size > SSD1306_GLYPH_CACHE_MAX_BYTES) {
+        return (font->glyphs + (index * font->glyph_size));
+    }
+    character = index + 1;      // never 0
+    entry = (index ^ (font_code << 5)) & (SSD1306_GLYPH_CACHE_ENTRIES - 1);
+    if ((glyph_cache[entry].character != character) || (glyph_cache[entry].font_code != font_code)) {
+        memcpy(glyph_cache[entry].glyph, (font->glyphs + (index * font->glyph_size)), font->glyph_size);
+        glyph_cache[entry].font_code = font_code;
+        glyph_cache[entry].character = character;
+        SSD1306_stats.glyph_cache_misses++;
+    } else {
+        SSD1306_stats.glyph_cache_hits++;
+    }
+    return glyph_cache[entry].glyph;
+#else
+    return (font->glyphs + (index * font->glyph_size));
 #endif
+}
 
 //==============================================================================
 /**
@@ -50,62 +135,127 @@ struct {
  * @return uint8_t 
  */
 __attribute__ ((warn_unused_result))
-uint8_t SSD1306_write_string(uint8_t font_code, uint8_t window,  uint8_t *buffer, bool invert) {
-
-uint8_t         pixel_width, pixel_height, nos_pages;
-uint8_t         segment, page;
-uint8_t         first_char, last_char;
-uint8_t         pixel_count;
-uint8_t         char_cnt, character;
-uint8_t         *ch_pt, *font_index, *font_pt, buff_index;
-uint8_t const   *font_base;
-
-    font_base    =  font_table[font_code];
-    pixel_width  = *font_base;
-    pixel_height = *(font_base + 1);
-    first_char   = *(font_base + 2);
-    last_char    = *(font_base + 3);
-    font_base    =  font_base + 4;       // skip  font header
-
-    segment = page_window_table[window].X1_seg_value;
-    page    = page_window_table[window].Y1_pag_value;
-
-    nos_pages = pixel_height/8;
-
-    char_cnt = strlen(buffer);
-    pixel_count = 0;
-    
-// outer page loop
-    for (uint8_t i=0 ; i < nos_pages ; i++) {
-        ch_pt = buffer;
-        buff_index = 1;    // used by I2C code
-// string loop
-        SSD1306_SetPointer(segment, page);
-        for (uint8_t j=0 ; j<char_cnt ; j++) {
-            character = *ch_pt++;
-            font_index = (uint8_t*)(font_base + ((character - first_char) * (pixel_width * nos_pages)));
-// write character
-            for (uint8_t k=i; k < (pixel_width * nos_pages); k=k+nos_pages) {
-    #ifdef SSD1306_INTERFACE_SPI
+uint8_t SSD1306_write_string(uint8_t font_code, uint8_t window, const uint8_t *buffer, bool invert) {
+
+    return SSD1306_write_cells(font_code, window, 0, strlen((const char *)buffer), buffer, invert);
+}
+
+//==============================================================================
+/**
+ * @brief output a run of character cells within a window
+ * 
+ * @param font_code     Index into table of available fonts
+ * @param window        Index into table of defined windows
+ * @param first_cell    character position in window of first character (0 = left edge)
+ * @param nos_cells     number of characters to output
+ * @param buffer        characters to output
+ * @param invert        invert string data
+ * @return uint8_t 
+ * 
+ * @note
+ * Only the columns of the cells written are marked dirty, so a flush
+ * sends just the changed cells.
+ */
+__attribute__ ((warn_unused_result))
+uint8_t SSD1306_write_cells(uint8_t font_code, uint8_t window, uint8_t first_cell, uint8_t nos_cells, const uint8_t *buffer, bool invert) {
+
+int16_t     x, y;
+
+    x = page_window_table[window].X1_seg_value + (first_cell * font_metrics[font_code].width);
+    y = page_window_table[window].Y1_pag_value * 8;
+    SSD1306_draw_text(font_code, x, y, buffer, nos_cells, invert);
+    return  0;
+}
+
+//==============================================================================
+/**
+ * @brief Draw text at any pixel position in display RAM copy
+ * 
+ * @param font_code     Index into table of available fonts
+ * @param x             left edge in pixels (may be partly off screen)
+ * @param y             top edge in pixels (may be partly off screen)
+ * @param buffer        characters to output
+ * @param nos_chars     number of characters to output
+ * @param invert        invert text data
+ * @return int16_t      x position after last character
+ * 
+ * @note
+ * Text is opaque : all pixels in the text box are written.  When y is a
+ * multiple of 8, each glyph page is copied straight into a display page.
+ * Otherwise each glyph byte is split across two display pages, keeping
+ * the pixels above and below the text box.
+ */
+int16_t SSD1306_draw_text(uint8_t font_code, int16_t x, int16_t y, const uint8_t *buffer, uint8_t nos_chars, bool invert)
+{
+const struct font_metrics_s   *font = &font_metrics[font_code];
+int16_t         column, top_page, page, first_col, last_col;
+uint8_t         shift, character, data, k_start, k_end;
+uint8_t         *ram_pt;
+const uint8_t   *glyph;
+
+    top_page = (y >= 0) ? (y / 8) : -((7 - y) / 8);     // round down
+    shift    = y - (top_page * 8);
+
+    column = x;
+    for (uint8_t j = 0; j < nos_chars; j++, column += font->width) {
+        if (column >= SSD1306_LCDWIDTH) {
+            break;
+        }
+        if ((column + font->width) <= 0) {
+            continue;
+        }
+        character = buffer[j];
+        if ((character < font->first_char) || (character > font->last_char)) {
+            character = font->first_char;
+        }
+        glyph = get_glyph(font_code, (character - font->first_char));
+        k_start = (column < 0) ? -column : 0;
+        k_end   = ((column + font->width) > SSD1306_LCDWIDTH) ? (SSD1306_LCDWIDTH - column) : font->width;
+
+        for (uint8_t i = 0; i < font->nos_pages; i++, glyph += font->width) {
+            page = top_page + i;
+            if (shift == 0) {
+            // fast path : page aligned
+                if ((page < 0) || (page >= SSD1306_NOS_PAGES)) {
+                    continue;
+                }
+                ram_pt = &SSD1306_RAM[(page * SSD1306_LCDWIDTH) + column + k_start];
                 if (invert == false) {
-                    SSD1306_WriteRam(*(font_index + k));
+                    memcpy(ram_pt, &glyph[k_start], (k_end - k_start));
                 } else {
-                    SSD1306_WriteRam(~(*(font_index + k)));
+                    for (uint8_t k = k_start; k < k_end; k++) {
+                        *ram_pt++ = ~glyph[k];
+                    }
                 }
-    #endif
+            } else {
+            // general path : glyph page straddles two display pages
+                for (uint8_t k = k_start; k < k_end; k++) {
+                    data = (invert == false) ? glyph[k] : ~glyph[k];
+                    if ((page >= 0) && (page < SSD1306_NOS_PAGES)) {
+                        ram_pt = &SSD1306_RAM[(page * SSD1306_LCDWIDTH) + column + k];
+                        *ram_pt = (*ram_pt & ~(0xFF << shift)) | (data << shift);
+                    }
+                    if (((page + 1) >= 0) && ((page + 1) < SSD1306_NOS_PAGES)) {
+                        ram_pt = &SSD1306_RAM[((page + 1) * SSD1306_LCDWIDTH) + column + k];
+                        *ram_pt = (*ram_pt & ~(0xFF >> (8 - shift))) | (data >> (8 - shift));
+                    }
+                }
+            }
+        }
+    }
 
-    #ifdef SSD1306_INTERFACE_I2C
-                tmp_buffer[buff_index++] = (invert == false) ? (*(font_index + k)) : (~(*(font_index + k)));
-    #endif
+// mark area written
+
+    first_col = (x < 0) ? 0 : x;
+    last_col  = ((column > SSD1306_LCDWIDTH) ? SSD1306_LCDWIDTH : column) - 1;
+    if (last_col >= first_col) {
+        for (page = top_page; page <= (top_page + font->nos_pages - ((shift == 0) ? 1 : 0)); page++) {
+            if ((page >= 0) && (page < SSD1306_NOS_PAGES)) {
+                SSD1306_mark_dirty(page, first_col, last_col);
             }
         }
-    #ifdef SSD1306_INTERFACE_I2C
-        // write line of data (page) in a single I2C command - faster because of less overhead
-        i2c_write_blocking(I2C_PORT, SSD1306_ADDRESS, tmp_buffer, sizeof(tmp_buffer), false);
-    #endif
-        page++;
     }
-    return  0;
+    return column;
 }
 
 //==============================================================================
@@ -117,45 +267,552 @@ uint8_t const   *font_base;
  */
 void SSD1306_set_window(uint8_t window, uint8_t byte_value) {
 
-    uint8_t nos_pages  = ((page_window_table[window].Y2_pag_value - page_window_table[window].Y1_pag_value) + 1);
     uint8_t nos_pixels = ((page_window_table[window].X2_seg_value - page_window_table[window].X1_seg_value) + 1);
 
     for (uint8_t i = page_window_table[window].Y1_pag_value ; i <= page_window_table[window].Y2_pag_value ; i++) {
-        SSD1306_SetPointer(page_window_table[window].X1_seg_value, i);
-        for (uint8_t j = page_window_table[window].X1_seg_value; j <= page_window_table[window].X2_seg_value ; j++) {
-            SSD1306_WriteRam(byte_value);
+        memset(&SSD1306_RAM[(i * SSD1306_LCDWIDTH) + page_window_table[window].X1_seg_value], byte_value, nos_pixels);
+        SSD1306_mark_dirty(i, page_window_table[window].X1_seg_value, page_window_table[window].X2_seg_value);
+    }
+}
+
+//==============================================================================
+/**
+ * @brief Write a block of bytes to display RAM at the current address
+ * 
+ * @param data      bytes to send
+ * @param len       number of bytes (max SSD1306_RAM_SIZE for I2C)
+ */
+void SSD1306_write_data(const uint8_t *data, uint32_t len)
+{
+#ifdef SSD1306_INTERFACE_SPI
+    gpio_put(OLED_CS, 1);
+    gpio_put(OLED_DC, 1);
+    gpio_put(OLED_CS, 0);
+    spi_write_blocking(SPI_PORT, data, len);
+    gpio_put(OLED_CS, 1);
+    SSD1306_stats.bytes_sent += len;
+    SSD1306_stats.transactions++;
+#endif
+
+#ifdef SSD1306_INTERFACE_I2C
+    SSD1306_i2c_write(SSD1306_CONTROL_DATA_STREAM, data, len);
+#endif
+}
+
+#ifdef SSD1306_INTERFACE_I2C
+//==============================================================================
+/**
+ * @brief I2C interrupt : end of DMA driven transaction
+ * 
+ * @note
+ * STOP is detected after the last byte has left the I2C FIFO, so this
+ * marks the true end of the transfer, not the end of the DMA.  A NACK
+ * aborts the transfer (the controller then issues a STOP) : the DMA is
+ * stopped first so that remaining data is not sent as a new transaction.
+ */
+static void SSD1306_i2c_irq_handler(void)
+{
+i2c_hw_t    *hw = i2c_get_hw(I2C_PORT);
+BaseType_t  xHigherPriorityTaskWoken = pdFALSE;
+
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+        dma_channel_abort(dma_channel);
+        (void)hw->clr_tx_abrt;
+        dma_aborted = true;
+    }
+    if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) {
+        (void)hw->clr_stop_det;
+        hw->intr_mask = 0;
+        if (dma_waiting_task != NULL) {
+            vTaskNotifyGiveIndexedFromISR(dma_waiting_task, SSD1306_DMA_NOTIFY_INDEX, &xHigherPriorityTaskWoken);
         }
     }
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
 }
+#endif
 
 //==============================================================================
 /**
- * @brief 
+ * @brief Set up DMA channel and interrupt for I2C transmit
  * 
- * @param first_row         upper scroll row (in range 1 to 4)
- * @param nos_rows          number of rows in scroll area
- * @param nos_strings       number of strings in scrolled menu
- * @param scroll_strings    set of scroll strings
+ * @note
+ * Called once, after the I2C port has been initialised.
  */
-void SSD1306_set_text_area_scroller(uint8_t nos_strings, char **scroll_strings)
+void SSD1306_dma_init(void)
 {
-uint8_t index, string_length;
+#ifdef SSD1306_INTERFACE_I2C
+i2c_hw_t            *hw = i2c_get_hw(I2C_PORT);
+dma_channel_config  config;
+
+    hw->enable = 0;
+    hw->tar    = SSD1306_ADDRESS;
+    hw->dma_cr = I2C_IC_DMA_CR_TDMAE_BITS;
+    hw->enable = 1;
+    hw->intr_mask = 0;
+
+    dma_channel = dma_claim_unused_channel(true);
+    config = dma_channel_get_default_config(dma_channel);
+    channel_config_set_transfer_data_size(&config, DMA_SIZE_16);
+    channel_config_set_read_increment(&config, true);
+    channel_config_set_write_increment(&config, false);
+    channel_config_set_dreq(&config, i2c_get_dreq(I2C_PORT, true));
+    dma_channel_configure(dma_channel, &config, &hw->data_cmd, dma_buffer, 0, false);
+
+    irq_set_exclusive_handler(I2C0_IRQ, SSD1306_i2c_irq_handler);
+    irq_set_enabled(I2C0_IRQ, true);
+    SSD1306_stats.i2c_baudrate = SSD1306_I2C_SPEED;
+#endif
+}
 
-    LCD_scroll_data.enable = false;
+//==============================================================================
+/**
+ * @brief Change I2C bus speed
+ * 
+ * @param baudrate  bits/sec
+ * 
+ * @note
+ * Timing registers can only be written with the controller disabled.
+ * Target address and DMA settings are kept.  Actual rate is recorded
+ * in SSD1306_stats.
+ */
+void SSD1306_i2c_set_speed(uint32_t baudrate)
+{
+#ifdef SSD1306_INTERFACE_I2C
+i2c_hw_t    *hw = i2c_get_hw(I2C_PORT);
+
+    hw->enable = 0;
+    SSD1306_stats.i2c_baudrate = i2c_set_baudrate(I2C_PORT, baudrate);
+    hw->enable = 1;
+    i2c_fault_count = 0;
+#endif
+}
+
+//==============================================================================
+/**
+ * @brief Try the display at Fast-mode Plus speed
+ * 
+ * @return true     running at SSD1306_I2C_FAST_SPEED
+ * @return false    no ACK at fast speed : running at SSD1306_I2C_SPEED
+ * 
+ * @note
+ * Sends a NOP command.  Not every SSD1306 module (or its pull-up
+ * resistors) will work at 1MHz.
+ */
+bool SSD1306_i2c_probe(void)
+{
+#ifdef SSD1306_INTERFACE_I2C
+static const uint8_t    nop_cmd = SSD1306_NOP;
+
+    SSD1306_i2c_set_speed(SSD1306_I2C_FAST_SPEED);
+    if (SSD1306_i2c_write(SSD1306_CONTROL_COMMAND_STREAM, &nop_cmd, 1) == true) {
+        return true;
+    }
+    SSD1306_i2c_set_speed(SSD1306_I2C_SPEED);
+    SSD1306_stats.speed_fallbacks++;
+#endif
+    return false;
+}
+
+//==============================================================================
+/**
+ * @brief Start copying bus transactions into a buffer
+ * 
+ * @param buffer    destination
+ * @param size      size of buffer in bytes
+ * 
+ * @note
+ * Caller must hold semaphore_SSD1306_display until SSD1306_capture_stop().
+ */
+void SSD1306_capture_start(uint8_t *buffer, uint32_t size)
+{
+    capture.size     = size;
+    capture.count    = 0;
+    capture.overflow = false;
+    capture.buffer   = buffer;
+}
+
+/**
+ * @brief Stop copying bus transactions
+ * 
+ * @param overflow      set true if any transaction did not fit in buffer
+ * @return uint32_t     bytes used in buffer
+ */
+uint32_t SSD1306_capture_stop(bool *overflow)
+{
+    capture.buffer = NULL;
+    *overflow = capture.overflow;
+    return capture.count;
+}
+
+static void capture_transaction(uint8_t control, const uint8_t *data, uint32_t len)
+{
+    if (capture.buffer == NULL) {
+        return;
+    }
+    if ((capture.count + 3 + len) > capture.size) {
+        capture.overflow = true;
+        return;
+    }
+    capture.buffer[capture.count++] = control;
+    capture.buffer[capture.count++] = len & 0xFF;
+    capture.buffer[capture.count++] = len >> 8;
+    memcpy(&capture.buffer[capture.count], data, len);
+    capture.count += len;
+}
+
+//==============================================================================
+/**
+ * @brief Time on the bus for a number of bytes at the current speed
+ * 
+ * @param nos_bytes     bytes including I2C address bytes
+ * @return uint32_t     uS (9 clocks per byte : 8 data + ACK)
+ */
+uint32_t SSD1306_bus_time_us(uint32_t nos_bytes)
+{
+    if (SSD1306_stats.i2c_baudrate == 0) {
+        return 0;
+    }
+    return (uint32_t)(((uint64_t)nos_bytes * 9 * 1000000) / SSD1306_stats.i2c_baudrate);
+}
+
+//==============================================================================
+/**
+ * @brief Send a control byte and a block of bytes as one I2C transaction
+ * 
+ * @param control   I2C control byte (command or data stream)
+ * @param data      bytes to send
+ * @param len       number of bytes (max SSD1306_RAM_SIZE)
+ * 
+ * @note
+ * Transfer is done by DMA.  The calling task sleeps until the I2C STOP
+ * interrupt, so bus time is free for other tasks.  Before the scheduler
+ * is running (interrupts may be masked), or when called from core 1
+ * (no FreeRTOS), the STOP is polled.
+ * 
+ * A failed transfer asks the next flush to resend the whole display.
+ * Repeated failures at the fast bus speed drop back to SSD1306_I2C_SPEED.
+ * 
+ * @return true     transfer complete
+ * @return false    NACK/abort or timeout
+ */
+bool SSD1306_i2c_write(uint8_t control, const uint8_t *data, uint32_t len)
+{
+#ifdef SSD1306_INTERFACE_I2C
+i2c_hw_t    *hw = i2c_get_hw(I2C_PORT);
+bool        scheduler_running, complete;
+
+    if (len > SSD1306_RAM_SIZE) {
+        len = SSD1306_RAM_SIZE;
+    }
+    dma_buffer[0] = control;
+    for (uint32_t i = 0; i < len; i++) {
+        dma_buffer[i + 1] = data[i];
+    }
+    dma_buffer[len] |= I2C_IC_DATA_CMD_STOP_BITS;
+    capture_transaction(control, data, len);
+
+    scheduler_running = (get_core_num() == 0) && (xTaskGetSchedulerState() == taskSCHEDULER_RUNNING);
+    dma_waiting_task = (scheduler_running == true) ? xTaskGetCurrentTaskHandle() : NULL;
+    if (scheduler_running == true) {
+        ulTaskNotifyTakeIndexed(SSD1306_DMA_NOTIFY_INDEX, pdTRUE, 0);     // clear any stale notification
+    }
+    dma_aborted = false;
+    (void)hw->clr_stop_det;
+    (void)hw->clr_tx_abrt;
+    if (scheduler_running == true) {
+        hw->intr_mask = I2C_IC_INTR_MASK_M_STOP_DET_BITS | I2C_IC_INTR_MASK_M_TX_ABRT_BITS;
+    }
+
+    dma_channel_transfer_from_buffer_now(dma_channel, dma_buffer, (len + 1));
+
+    complete = true;
+    if (scheduler_running == true) {
+        if (ulTaskNotifyTakeIndexed(SSD1306_DMA_NOTIFY_INDEX, pdTRUE, (SSD1306_DMA_TIMEOUT_MS / portTICK_PERIOD_MS)) == 0) {
+            hw->intr_mask = 0;
+            dma_channel_abort(dma_channel);
+            SSD1306_stats.dma_timeouts++;
+            log_error(SSD1306_I2C_TIMEOUT, TASK_DISPLAY);
+            complete = false;
+        }
+    } else {
+        while ((hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_STOP_DET_BITS) == 0) {
+            tight_loop_contents();
+        }
+        if (hw->raw_intr_stat & I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS) {
+            dma_channel_abort(dma_channel);
+            (void)hw->clr_tx_abrt;
+            dma_aborted = true;
+        }
+        (void)hw->clr_stop_det;
+    }
+    dma_waiting_task = NULL;
+    if (dma_aborted == true) {
+        SSD1306_stats.bus_aborts++;
+        if (scheduler_running == true) {
+            log_error(SSD1306_I2C_ABORT, TASK_DISPLAY);
+        }
+        complete = false;
+    }
+    SSD1306_stats.bytes_sent += (len + 1);
+    SSD1306_stats.transactions++;
+
+    if (complete == false) {
+        resend_all = true;
+        if (SSD1306_stats.i2c_baudrate > SSD1306_I2C_SPEED) {
+            i2c_fault_count++;
+            if (i2c_fault_count >= SSD1306_I2C_FAULT_LIMIT) {
+                SSD1306_i2c_set_speed(SSD1306_I2C_SPEED);
+                SSD1306_stats.speed_fallbacks++;
+                if (scheduler_running == true) {
+                    log_error(SSD1306_I2C_SPEED_FALLBACK, TASK_DISPLAY);
+                }
+            }
+        }
+    }
+    return complete;
+#else
+    return true;
+#endif
+}
+
+//==============================================================================
+/**
+ * @brief Record area of display RAM copy that has changed
+ * 
+ * @param page          0 to 7
+ * @param first_seg     first column changed (0 to 127)
+ * @param last_seg      last column changed (0 to 127)
+ */
+void SSD1306_mark_dirty(uint8_t page, uint8_t first_seg, uint8_t last_seg)
+{
+    if ((page >= SSD1306_NOS_PAGES) || (first_seg >= SSD1306_LCDWIDTH)) {
+        return;
+    }
+    if (last_seg >= SSD1306_LCDWIDTH) {
+        last_seg = SSD1306_LCDWIDTH - 1;
+    }
+    for (uint32_t seg = first_seg; seg <= last_seg; seg++) {
+        dirty_mask[page][seg >> 5] |= (1UL << (seg & 0x1F));
+    }
+}
+
+void SSD1306_mark_all_dirty(void)
+{
+    memset(dirty_mask, 0xFF, sizeof(dirty_mask));
+}
+
+//==============================================================================
+/**
+ * @brief Display page that holds a page of the display RAM copy
+ * 
+ * @param page      page of RAM copy (0 to 7)
+ * @return uint8_t  page of display RAM
+ * 
+ * @note
+ * The RAM copy is always in screen order.  After scroll steps, pages of
+ * the scroll area are held in rotated order in the display RAM.
+ */
+static inline uint8_t display_page(uint8_t page)
+{
+    if ((page < SCROLL_AREA_FIRST_PAGE) || (page >= (SCROLL_AREA_FIRST_PAGE + SCROLL_AREA_NOS_PAGES))) {
+        return page;
+    }
+    return SCROLL_AREA_FIRST_PAGE + (((page - SCROLL_AREA_FIRST_PAGE) + (scroll_rotation * 2)) % SCROLL_AREA_NOS_PAGES);
+}
 
-    LCD_scroll_data.nos_strings = nos_strings;
-    for (index = 0; index < nos_strings; index++) {
-        strncpy(LCD_scroll_data.string_data[index], scroll_strings[index], LCD_NOS_ROW_CHARACTERS);
+//==============================================================================
+/**
+ * @brief One pass over the dirty areas of the display RAM copy
+ * 
+ * @note
+ * Uses the horizontal addressing mode set at initialisation.  Adjacent
+ * pages with the same dirty columns are grouped.  Each run of dirty
+ * columns in a group is sent as one block : the column/page address
+ * window is set, then all the data goes in one transaction as the
+ * address wraps from the end of one page to the next.  Runs separated
+ * by less than SSD1306_DIRTY_MERGE_GAP clean columns are joined, as
+ * re-sending those columns is cheaper than a new address window.
+ * Groups are split where the scroll area wraps in display RAM.
+ */
+static void flush_dirty_areas(void)
+{
+uint8_t     page, end_page, first_seg, last_seg, span, seg;
+uint32_t    nos_bytes;
+uint8_t     address_cmds[6];
+bool        clean;
+
+    page = 0;
+    while (page < SSD1306_NOS_PAGES) {
+        clean = true;
+        for (uint8_t i = 0; i < DIRTY_MASK_WORDS; i++) {
+            if (dirty_mask[page][i] != 0) {
+                clean = false;
+            }
+        }
+        if (clean == true) {
+            page++;
+            continue;
+        }
+        end_page = page;
+        while (((end_page + 1) < SSD1306_NOS_PAGES) &&
+               (display_page(end_page + 1) == (display_page(end_page) + 1)) &&
+               (memcmp(dirty_mask[end_page + 1], dirty_mask[page], sizeof(dirty_mask[0])) == 0)) {
+            end_page++;
+        }
+
+        seg = 0;
+        while (seg < SSD1306_LCDWIDTH) {
+            if (!IS_DIRTY(page, seg)) {
+                seg++;
+                continue;
+            }
+            first_seg = seg;
+            last_seg  = seg;
+            for (seg = first_seg + 1; seg < SSD1306_LCDWIDTH; seg++) {
+                if (IS_DIRTY(page, seg)) {
+                    last_seg = seg;
+                } else if ((seg - last_seg) > SSD1306_DIRTY_MERGE_GAP) {
+                    break;
+                }
+            }
+            seg = last_seg + 1;
+
+            address_cmds[0] = SET_COLUMN_ADDRESS;
+            address_cmds[1] = first_seg;
+            address_cmds[2] = last_seg;
+            address_cmds[3] = SET_PAGE_ADDRESS;
+            address_cmds[4] = display_page(page);
+            address_cmds[5] = display_page(end_page);
+            SSD1306_command_seq(address_cmds, sizeof(address_cmds));
+
+            span = (last_seg - first_seg) + 1;
+            nos_bytes = 0;
+            for (uint8_t i = page; i <= end_page; i++) {
+                memcpy(&flush_buffer[nos_bytes], &SSD1306_RAM[(i * SSD1306_LCDWIDTH) + first_seg], span);
+                nos_bytes += span;
+            }
+            SSD1306_write_data(flush_buffer, nos_bytes);
+        }
+        for (uint8_t i = page; i <= end_page; i++) {
+            memset(dirty_mask[i], 0, sizeof(dirty_mask[0]));
+        }
+        page = end_page + 1;
     }
-    LCD_scroll_data.string_count = 0;
-    LCD_scroll_data.nos_LCD_rows = SCROLL_AREA_NOS_ROWS;   // nos_rows
-    LCD_scroll_data.first_LCD_row = SCROLL_ROW_UPPER;    // first_row
 
-    LCD_scroll_data.scroll_delay_count = 0;
-    LCD_scroll_data.scroll_delay = SCROLL_DELAY_TICK_COUNT;
+}
+
+//==============================================================================
+/**
+ * @brief Send changed areas of display RAM copy to the display
+ * 
+ * @note
+ * If a transfer fails, the whole display is sent again (once) so that
+ * the display matches the RAM copy; this also covers a drop to the
+ * fallback bus speed part way through a flush.
+ * 
+ * Caller must hold semaphore_SSD1306_display.
+ */
+void SSD1306_flush(void)
+{
+uint32_t    start_time, flush_time;
+
+    start_time = time_us_32();
+    for (uint8_t pass = 0; pass < 2; pass++) {
+        resend_all = false;
+        flush_dirty_areas();
+        if (resend_all == false) {
+            break;
+        }
+        SSD1306_mark_all_dirty();       // one retry now, otherwise on next flush
+    }
 
-    LCD_scroll_data.enable = true;
+    flush_time = time_us_32() - start_time;
+    SSD1306_stats.flush_count++;
+    SSD1306_stats.last_flush_us = flush_time;
+    if (flush_time > SSD1306_stats.max_flush_us) {
+        SSD1306_stats.max_flush_us = flush_time;
+    }
+}
 
+//==============================================================================
+/**
+ * @brief Clear display transfer statistics
+ */
+void SSD1306_reset_stats(void)
+{
+    memset(&SSD1306_stats, 0, sizeof(struct SSD1306_stats_s));
+}
+
+//==============================================================================
+/**
+ * @brief Restrict display start line to the scroll area and set it to zero
+ * 
+ * @note
+ * Call after the display has been initialised.  Scroll area pages are
+ * marked dirty, as the display RAM order changes back to screen order.
+ * Caller must hold semaphore_SSD1306_display.
+ */
+void SSD1306_scroll_area_reset(void)
+{
+uint8_t     commands[4];
+
+    commands[0] = SET_VERTICAL_SCROLL_AREA;
+    commands[1] = SCROLL_AREA_FIRST_PAGE * 8;       // rows in top fixed area
+    commands[2] = SCROLL_AREA_NOS_PAGES * 8;        // rows in scroll area
+    commands[3] = SET_DISPLAY_START_LINE | 0;
+    SSD1306_command_seq(commands, sizeof(commands));
+    if (scroll_rotation != 0) {
+        scroll_rotation = 0;
+        for (uint8_t page = SCROLL_AREA_FIRST_PAGE; page < (SCROLL_AREA_FIRST_PAGE + SCROLL_AREA_NOS_PAGES); page++) {
+            SSD1306_mark_dirty(page, 0, (SSD1306_LCDWIDTH - 1));
+        }
+    }
+}
+
+//==============================================================================
+/**
+ * @brief Move scroll area up one text row using the display start line
+ * 
+ * @note
+ * The display RAM is not written : the top row of the scroll area wraps
+ * to the bottom.  The RAM copy and its dirty areas are rotated to match,
+ * so a following write of the bottom row sends just that row.
+ * Caller must hold semaphore_SSD1306_display.
+ */
+void SSD1306_scroll_area_step(void)
+{
+uint8_t     *area_pt = &SSD1306_RAM[SCROLL_AREA_FIRST_PAGE * SSD1306_LCDWIDTH];
+uint32_t    top_dirty[2][DIRTY_MASK_WORDS];
+
+    memcpy(flush_buffer, area_pt, (2 * SSD1306_LCDWIDTH));
+    memmove(area_pt, &area_pt[2 * SSD1306_LCDWIDTH], ((SCROLL_AREA_NOS_PAGES - 2) * SSD1306_LCDWIDTH));
+    memcpy(&area_pt[(SCROLL_AREA_NOS_PAGES - 2) * SSD1306_LCDWIDTH], flush_buffer, (2 * SSD1306_LCDWIDTH));
+
+    memcpy(top_dirty, dirty_mask[SCROLL_AREA_FIRST_PAGE], sizeof(top_dirty));
+    memmove(dirty_mask[SCROLL_AREA_FIRST_PAGE], dirty_mask[SCROLL_AREA_FIRST_PAGE + 2], ((SCROLL_AREA_NOS_PAGES - 2) * sizeof(dirty_mask[0])));
+    memcpy(dirty_mask[SCROLL_AREA_FIRST_PAGE + SCROLL_AREA_NOS_PAGES - 2], top_dirty, sizeof(top_dirty));
+
+    scroll_rotation = (scroll_rotation + 1) % SCROLL_AREA_NOS_ROWS;
+    SSD1306_command(SET_DISPLAY_START_LINE | (scroll_rotation * 16));
+    SSD1306_stats.scroll_steps++;
+}
+
+//==============================================================================
+/**
+ * @brief Load scroll area strings
+ * 
+ * @note
+ * To change other rows in the same display update, call
+ * LCD_update_scroller() within LCD_update_begin()/LCD_update_end().
+ * 
+ * @param nos_strings       number of strings in scrolled menu
+ * @param scroll_strings    set of scroll strings
+ */
+void SSD1306_set_text_area_scroller(uint8_t nos_strings, const char **scroll_strings)
+{
+    LCD_update_begin();
+        LCD_update_scroller(nos_strings, scroll_strings);
+    LCD_update_end();
     return;
 }
 
@@ -176,23 +833,22 @@ inline void cancel_scroller(void)
  * @param window 
  * @param nos_strings 
  * @param message_strings 
- * 
- * @note  To-Do : deal with errors returned
+ * @return uint8_t      OK, or the error returned by a string write
  */
-void SSD1306_set_text_area(uint8_t window, uint8_t nos_strings, char *message_strings[])
+uint8_t SSD1306_set_text_area(uint8_t window, uint8_t nos_strings, char *message_strings[])
 {
-error_codes_te error;
+uint8_t     error = OK;
 
     //SSD1306_set_window(SCROLL_WINDOW, '\0');   // clear test area window
 
     if (nos_strings == 1) {
-        error = SSD1306_write_string(0, SCROLL_ROW_UPPER,  message_strings[0], false);
+        error  = SSD1306_write_string(0, SCROLL_ROW_UPPER,  (const uint8_t *)message_strings[0], false);
     } else if (nos_strings == 2) {
-        error = SSD1306_write_string(0, SCROLL_ROW_UPPER,  message_strings[0], false);
-        error = SSD1306_write_string(0, SCROLL_ROW_LOWER,  message_strings[1], false);
+        error  = SSD1306_write_string(0, SCROLL_ROW_UPPER,  (const uint8_t *)message_strings[0], false);
+        error |= SSD1306_write_string(0, SCROLL_ROW_LOWER,  (const uint8_t *)message_strings[1], false);
     };
 
-    return;
+    return error;
 }
 
 
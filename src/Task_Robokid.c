@@ -13,6 +13,7 @@
 #include "menus.h"
 #include "run_gamepad_modes.h"
 #include "run_test_modes.h"
+#include "sprites.h"
 
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
@@ -26,22 +27,43 @@
 
 #define   LONG_PRESS_MS  4000        // 4 seconds
 
+#define   BOOT_SPINNER_X      100
+#define   BOOT_SPINNER_Y      16         // on MESSAGE_ROW
+
 //==============================================================================
 // Main task routine
 //==============================================================================
 void Task_Robokid(void *p) 
 {
 uint32_t                    start_time, end_time;
-uint8_t                     index;
 EventBits_t                 event_bits;
 //primary_sys_modes_te        primary_mode, first_mode, last_mode;
 uint32_t                    press_time;
 error_codes_te              error;
+#ifdef DISPLAY_ON_CORE1
+uint8_t                     index;
+#else
+struct sprite_s             boot_spinner;
+TickType_t                  xLastWakeTime;
+uint32_t                    frame;
+#endif
 
+#ifdef DISPLAY_ON_CORE1
     for (index = 0; index < (TASK_ROBOKID_START_DELAY_SECONDS * 2); index++) {
         LCD_write_row(0, MESSAGE_ROW, system_busy[index % 4], false);
         vTaskDelay(HALF_SECOND);
     }
+#else
+    LCD_write_row(0, MESSAGE_ROW, " Robokid      ", false);
+    vTaskDelay(2 * TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT);     // row drawn before spinner saves it
+    sprite_init(&boot_spinner, &spinner_animation, BOOT_SPINNER_X, BOOT_SPINNER_Y);
+    xLastWakeTime = xTaskGetTickCount();
+    for (frame = 0; frame < ((TASK_ROBOKID_START_DELAY_SECONDS * 1000) / SPRITE_FRAME_MS); frame++) {
+        sprite_update(&boot_spinner, 1);
+        xTaskDelayUntil(&xLastWakeTime, (SPRITE_FRAME_MS / portTICK_PERIOD_MS));
+    }
+    sprite_hide(&boot_spinner, 1);
+#endif
 
     set_n_LEDS(STRING_COUNT(wait_start));
     SSD1306_set_text_area_scroller(STRING_COUNT(wait_start), wait_start);
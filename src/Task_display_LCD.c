@@ -4,6 +4,7 @@
  * @brief Manage display of information on SSD1306 LCD display
  */
 #include <stdio.h>
+#include <string.h>
 
 #include "system.h"
 #include "common.h"
@@ -14,6 +15,8 @@
 
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
+#include "pico/multicore.h"
+#include "hardware/sync.h"
 
 #include "FreeRTOS.h"
 
@@ -21,8 +24,45 @@
 // function prototypes for local routines
 //==============================================================================
 static void process_icons(void); 
-static void process_scroller(void);
-static void LCD_dump_row_data(void);
+static void process_scroller(bool scroll_step);
+static void scroller_update_rows(bool scroll_step);
+static bool scroller_running(void);
+static TickType_t next_update_interval(uint32_t frame_us);
+static bool LCD_dump_row_data(void);
+static void LCD_render_row(uint8_t index, const struct LCD_row_data_s *row);
+#ifdef SSD1306_HW_SCROLL
+static void scroll_area_step(void);
+#endif
+
+//==============================================================================
+// Copy of rows as rendered to display : used to find changed characters.
+// Only accessed by the code doing the rendering (display task or core 1).
+//==============================================================================
+static struct {
+    bool    valid;
+    uint8_t font;
+    bool    invert;
+    char    row_string[LCD_ROW_STRING_LENGTH];
+} sent_row_data[SS1306_NOS_LCD_ROWS];
+
+#ifdef DISPLAY_ON_CORE1
+//==============================================================================
+// Row updates from display task (core 0) to display loop (core 1).
+// Single producer, single consumer : head only written by core 0, tail
+// only written by core 1.
+//==============================================================================
+static struct {
+    volatile uint32_t   head;
+    volatile uint32_t   tail;
+    struct {
+        uint8_t                 index;
+        struct LCD_row_data_s   row;
+    } entry[DISPLAY_RING_SIZE];
+} display_ring;
+
+static bool display_ring_put(uint8_t index, const struct LCD_row_data_s *row);
+static void display_core1_loop(void);
+#endif
 
 //==============================================================================
 // Task code
@@ -30,30 +70,69 @@ static void LCD_dump_row_data(void);
 /**
  * @brief Task to control display of SSD1306 display
  * 
+ * @note
+ * Task sleeps until notified of new data (see LCD_notify_update), so an
+ * unchanging display costs no CPU time.  The only timed wake-ups are the
+ * scroller step while more than two strings are scrolling, and a retry
+ * when rows did not fit in the core 1 ring.  After an
+ * update, the task waits for the rest of the minimum update interval so
+ * that a burst of changes is shown in one update.  The interval adapts
+ * to the class of screen and to the measured cost of an update (see
+ * next_update_interval).
+ * 
  * @param p 
  */
 void Task_display_LCD (void *p) 
 {
-uint32_t    start_time, end_time;
-TickType_t  xLastWakeTime;
-BaseType_t  xWasDelayed;
+TickType_t  last_update_time, last_scroll_time, elapsed, time_out, interval;
+uint32_t    start_time;
+bool        scroll_step, rows_pending;
 
+#ifdef DISPLAY_ON_CORE1
+    multicore_launch_core1(display_core1_loop);
+#else
     SSD1306_init();
+#endif
 
 // print hello message 
 
     LCD_write_row(0, MESSAGE_ROW, "Robokid 2", false);
     ENABLE_SCROLLER;
     
-    xLastWakeTime = xTaskGetTickCount ();
+    last_update_time = xTaskGetTickCount();
+    last_scroll_time = last_update_time;
+    interval = next_update_interval(0);
+    rows_pending = false;
     FOREVER {
-        xWasDelayed = xTaskDelayUntil( &xLastWakeTime, TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT );
+    // sleep until notified, or until next scroller step is due
+        time_out = portMAX_DELAY;
+        if (scroller_running() == true) {
+            elapsed  = xTaskGetTickCount() - last_scroll_time;
+            time_out = (elapsed >= TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT) ? 0 : (TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT - elapsed);
+        }
+        if (rows_pending == true) {
+            time_out = 0;           // rows left over from last update : retry after interval
+        }
+        ulTaskNotifyTakeIndexed(LCD_UPDATE_NOTIFY_INDEX, pdTRUE, time_out);
+    // rate limit : gather any further updates until minimum interval is up
+        elapsed = xTaskGetTickCount() - last_update_time;
+        if (elapsed < interval) {
+            vTaskDelay(interval - elapsed);
+        }
+        ulTaskNotifyTakeIndexed(LCD_UPDATE_NOTIFY_INDEX, pdTRUE, 0);    // included in this update
+        start_time = time_us_32();
     // process icons
         process_icons();
     //  process_scrolling_message
-        process_scroller();
+        scroll_step = ((xTaskGetTickCount() - last_scroll_time) >= TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT);
+        if (scroll_step == true) {
+            last_scroll_time = xTaskGetTickCount();
+        }
+        process_scroller(scroll_step);
     // update display
-        LCD_dump_row_data();
+        rows_pending = LCD_dump_row_data();
+        last_update_time = xTaskGetTickCount();
+        interval = next_update_interval(time_us_32() - start_time);
     }
 }
 
@@ -63,39 +142,60 @@ BaseType_t  xWasDelayed;
 /**
  * @brief Generate set of display icons.
  * 
+ * @note
+ * Error state, battery level and gamepad data each carry a generation
+ * count that is incremented by the producer on every change.  The icon
+ * row is only rebuilt when one of these has moved.
  */
 static void process_icons(void) 
 {
+static bool     icons_valid = false;
+static uint32_t last_error_generation, last_battery_generation, last_gamepad_generation;
+uint32_t        error_generation, battery_generation, gamepad_generation;
 char            buffer[16], buffer_pt;
-uint16_t        battery_volts;
+uint8_t         battery;
 error_codes_te  error;
 
     buffer_pt = 0;
 
-// Error state
+// Error state and battery level
 
     xSemaphoreTake(semaphore_system_status, portMAX_DELAY);
         error = system_status.error_state;
-//battery_volts = system_IO_data.analogue_global_data.processed[MOTOR_VOLTAGE_CHANNEL].value;
+        error_generation = system_status.generation;
     xSemaphoreGive(semaphore_system_status);
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        battery = system_IO_data.battery_data.icon;
+        battery_generation = system_IO_data.battery_data.generation;
+    xSemaphoreGive(semaphore_system_IO_data);
+
+    xSemaphoreTake(semaphore_gamepad_data, portMAX_DELAY);
+        gamepad_generation = gamepad_data.generation;
+    xSemaphoreGive(semaphore_gamepad_data);
+
+// Skip if no input has changed since last build
+
+    if ((icons_valid == true) &&
+        (error_generation == last_error_generation) &&
+        (battery_generation == last_battery_generation) &&
+        (gamepad_generation == last_gamepad_generation)) {
+        SSD1306_stats.icon_rows_suppressed++;
+        return;
+    }
+    icons_valid             = true;
+    last_error_generation   = error_generation;
+    last_battery_generation = battery_generation;
+    last_gamepad_generation = gamepad_generation;
+    SSD1306_stats.icon_row_builds++;
+
     if (error <= OK) {
         buffer[buffer_pt++] = ERROR_ICON;
     }
 
 // Battery icon
 
-    if (battery_volts > V_BATT_100_PERCENT) {
-        buffer[buffer_pt] = BATTERY_FULL;
-    } else if (battery_volts > V_BATT_75_PERCENT) {
-        buffer[buffer_pt] = BATTERY_75;
-    } else if (battery_volts > V_BATT_50_PERCENT) {
-        buffer[buffer_pt] = BATTERY_HALF;
-    } else if (battery_volts > V_BATT_25_PERCENT) {
-        buffer[buffer_pt] = BATTERY_25;
-    } else
-        buffer[buffer_pt] = BATTERY_EMPTY;
-
-    buffer_pt++;
+    buffer[buffer_pt++] = battery;
 
 // Gamepad icons : access data via MUTEX
 
@@ -159,10 +259,29 @@ error_codes_te  error;
  * 
  * @note modify fir 1 and 2 row displays that do not need to scroll
  * 
+ * @param scroll_step   true once per display time unit (scroll delay is counted in these)
+ */
+static void process_scroller(bool scroll_step)
+{
+    LCD_update_begin();
+        scroller_update_rows(scroll_step);
+    LCD_update_end();
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Write scroll area rows for current scroller state
+ * 
+ * @note
+ * Called with LCD data MUTEX held, so all rows of a scroll step are
+ * published together and scroller state cannot change part way through.
+ * 
+ * @param scroll_step   true once per display time unit
  */
-static void process_scroller(void)
+static void scroller_update_rows(bool scroll_step)
 {
-uint8_t window, index;
+uint8_t index;
 
     if (LCD_scroll_data.enable == false) {
         return;
@@ -171,29 +290,35 @@ uint8_t window, index;
 // special case for 1 and two row scrolling : don't scroll
 
     if (LCD_scroll_data.nos_strings == 1) {
-        LCD_write_row(0,LCD_scroll_data.first_LCD_row, LCD_scroll_data.string_data[0], false);
-        LCD_write_row(0,LCD_scroll_data.first_LCD_row+1, blank_row, false);
+        LCD_update_row(0,LCD_scroll_data.first_LCD_row, LCD_scroll_data.string_data[0], false);
+        LCD_update_row(0,LCD_scroll_data.first_LCD_row+1, blank_row, false);
         return;
     }
     if (LCD_scroll_data.nos_strings == 2) {
-        LCD_write_row(0,LCD_scroll_data.first_LCD_row, LCD_scroll_data.string_data[0], false);
-        LCD_write_row(0,LCD_scroll_data.first_LCD_row+1, LCD_scroll_data.string_data[1], false);
+        LCD_update_row(0,LCD_scroll_data.first_LCD_row, LCD_scroll_data.string_data[0], false);
+        LCD_update_row(0,LCD_scroll_data.first_LCD_row+1, LCD_scroll_data.string_data[1], false);
         return;
     }
-    if (LCD_scroll_data.scroll_delay_count > 0) {
+    if (LCD_scroll_data.restart == true) {
+        LCD_scroll_data.restart = false;
+        LCD_scroll_data.scroll_delay_count = LCD_scroll_data.scroll_delay;
+    } else if (scroll_step == false) {
+        return;
+    } else if (LCD_scroll_data.scroll_delay_count > 0) {
         LCD_scroll_data.scroll_delay_count--;
         return;
     } else {
         LCD_scroll_data.scroll_delay_count = LCD_scroll_data.scroll_delay;  // reset delay count
+#ifdef SSD1306_HW_SCROLL
+        LCD_scroll_data.hw_step = true;         // upper row moves up out of view, lower row moves up
+#endif
     }
-    window = LCD_scroll_data.first_LCD_row;
     for (index = 0; index < LCD_scroll_data.nos_LCD_rows; index++) {
-        LCD_write_row(0, LCD_scroll_data.first_LCD_row+index, LCD_scroll_data.string_data[LCD_scroll_data.string_count], false);
+        LCD_update_row(0, LCD_scroll_data.first_LCD_row+index, LCD_scroll_data.string_data[LCD_scroll_data.string_count], false);
         LCD_scroll_data.string_count += 1; 
         if (LCD_scroll_data.string_count >= LCD_scroll_data.nos_strings) {
             LCD_scroll_data.string_count = 0;
         }
-        window++;
     }
     if (LCD_scroll_data.string_count == 0) {
         LCD_scroll_data.string_count = LCD_scroll_data.nos_strings - 1;
@@ -203,23 +328,236 @@ uint8_t window, index;
     return;
 }
 
+//==============================================================================
+/**
+ * @brief Calculate minimum interval before next display update
+ * 
+ * @param frame_us      time taken by last update (0 at start)
+ * @return TickType_t   interval in ticks
+ * 
+ * @note
+ * The class of screen sets the fastest update rate.  The cost of an
+ * update is smoothed over a few updates, and the interval is stretched
+ * so that updates use no more than LCD_BUDGET_PERCENT of the time.  As
+ * the I2C transfer is inside the update time, this also limits bus use.
+ * With DISPLAY_ON_CORE1 the flush is not part of the update, so the
+ * flush time measured by core 1 is used if it is longer.
+ */
+static TickType_t next_update_interval(uint32_t frame_us)
+{
+uint32_t    interval_ms, budget_ms;
+
+#ifdef DISPLAY_ON_CORE1
+    if (SSD1306_stats.last_flush_us > frame_us) {
+        frame_us = SSD1306_stats.last_flush_us;
+    }
+#endif
+    SSD1306_stats.frame_cost_us = ((SSD1306_stats.frame_cost_us * 3) + frame_us) / 4;
+    SSD1306_stats.frame_time_us += frame_us;
+
+    interval_ms = (LCD_refresh_class == LCD_CLASS_LIVE) ? LCD_LIVE_UPDATE_INTERVAL_MS : LCD_MENU_UPDATE_INTERVAL_MS;
+    budget_ms = (((SSD1306_stats.frame_cost_us * 100) / LCD_BUDGET_PERCENT) + 999) / 1000;
+    if (budget_ms > interval_ms) {
+        interval_ms = budget_ms;
+    }
+    if (interval_ms > LCD_MAX_UPDATE_INTERVAL_MS) {
+        interval_ms = LCD_MAX_UPDATE_INTERVAL_MS;
+    }
+    SSD1306_stats.update_interval_ms = interval_ms;
+    return (interval_ms / portTICK_PERIOD_MS);
+}
+
+//==============================================================================
+/**
+ * @brief Check if scroller needs timed updates
+ * 
+ * @return true     more than two strings are scrolling
+ */
+static bool scroller_running(void)
+{
+    return ((LCD_scroll_data.enable == true) && (LCD_scroll_data.nos_strings > 2));
+}
+
 //==============================================================================
 /**
  * @brief dump SSD1306 row data to display.
  * 
  * SSD1306 is used as FOUR rows of 14 characters.  If possible,
  * all SSD1306 output should go through this routine.
+ * 
+ * @note
+ * Changed character cells are rendered into the display RAM copy, then
+ * only the changed areas are sent to the display in a single flush.
+ * With DISPLAY_ON_CORE1, changed rows are passed to core 1 instead;
+ * a row that does not fit in the ring stays dirty for the next cycle.
+ *
+ * @return true     rows still dirty (core 1 ring full)
  */
-static void LCD_dump_row_data(void)
+static bool LCD_dump_row_data(void)
 {
-    for (uint8_t index = 0; index < SS1306_NOS_LCD_ROWS; index++) {
-        if (LCD_row_data[index].dirty_bit == true) {
-            xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
-              SSD1306_write_string(LCD_row_data[index].font, index+1, &LCD_row_data[index].row_string[0], LCD_row_data[index].invert);
-            xSemaphoreGive(semaphore_SSD1306_display);
-            LCD_row_data[index].dirty_bit = false;
+bool    rows_pending;
+
+    rows_pending = false;
+#ifdef DISPLAY_ON_CORE1
+    xSemaphoreTake(semaphore_LCD_data, portMAX_DELAY);
+        for (uint8_t index = 0; index < SS1306_NOS_LCD_ROWS; index++) {
+            if (LCD_row_data[index].dirty_bit == true) {
+                if (display_ring_put(index, &LCD_row_data[index]) == false) {
+                    rows_pending = true;
+                    break;
+                }
+                LCD_row_data[index].dirty_bit = false;
+                LCD_row_data[index].refresh   = false;
+            }
+        }
+    xSemaphoreGive(semaphore_LCD_data);
+    __sev();                // wake core 1
+#else
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        xSemaphoreTake(semaphore_LCD_data, portMAX_DELAY);
+#ifdef SSD1306_HW_SCROLL
+            if (LCD_scroll_data.hw_step == true) {
+                LCD_scroll_data.hw_step = false;
+                scroll_area_step();
+            }
+#endif
+            for (uint8_t index = 0; index < SS1306_NOS_LCD_ROWS; index++) {
+                if (LCD_row_data[index].dirty_bit == true) {
+                    LCD_render_row(index, &LCD_row_data[index]);
+                    LCD_row_data[index].dirty_bit = false;
+                    LCD_row_data[index].refresh   = false;
+                }
+            }
+        xSemaphoreGive(semaphore_LCD_data);
+        SSD1306_flush();
+    xSemaphoreGive(semaphore_SSD1306_display);
+#endif
+    return rows_pending;
+}
+
+//==============================================================================
+/**
+ * @brief Render the characters of a row that differ from those on the display
+ * 
+ * @param index     row index (0 to 3)
+ * @param row       new row data
+ * 
+ * @note
+ * A refresh request, a change of font or invert, or a row with no record
+ * of what is on the display, is written in full.  Otherwise each run of
+ * changed characters is written.  If the driver returns an error, the row
+ * is left without a record, so that it is written in full next time.
+ */
+static void LCD_render_row(uint8_t index, const struct LCD_row_data_s *row)
+{
+uint8_t     cell, first_cell, nos_cells;
+uint8_t     error;
+
+    error = OK;
+    nos_cells = strlen(row->row_string);
+    if ((row->refresh == true) || (sent_row_data[index].valid == false) ||
+        (sent_row_data[index].font != row->font) || (sent_row_data[index].invert != row->invert)) {
+        error = SSD1306_write_string(row->font, index+1, (const uint8_t *)row->row_string, row->invert);
+    } else {
+        cell = 0;
+        while (cell < nos_cells) {
+            if (row->row_string[cell] == sent_row_data[index].row_string[cell]) {
+                cell++;
+                continue;
+            }
+            first_cell = cell;
+            while ((cell < nos_cells) && (row->row_string[cell] != sent_row_data[index].row_string[cell])) {
+                cell++;
+            }
+            error |= SSD1306_write_cells(row->font, index+1, first_cell, (cell - first_cell), (const uint8_t *)&row->row_string[first_cell], row->invert);
         }
     }
+    strcpy(sent_row_data[index].row_string, row->row_string);
+    sent_row_data[index].font   = row->font;
+    sent_row_data[index].invert = row->invert;
+    sent_row_data[index].valid  = (error == OK);
+    return;
+}
+
+#ifdef SSD1306_HW_SCROLL
+//==============================================================================
+/**
+ * @brief Move scroll area up one row without rewriting it
+ * 
+ * @note
+ * The display start line moves the rows already on the display, and
+ * the record of rendered rows is rotated to match.  Rendering then only
+ * sends the characters of the new bottom row.
+ */
+static void scroll_area_step(void)
+{
+uint8_t     top_row[sizeof(sent_row_data[0])];
+
+    SSD1306_scroll_area_step();
+    memcpy(top_row, &sent_row_data[SCROLL_ROW_UPPER - 1], sizeof(top_row));
+    memmove(&sent_row_data[SCROLL_ROW_UPPER - 1], &sent_row_data[SCROLL_ROW_UPPER], ((SCROLL_AREA_NOS_ROWS - 1) * sizeof(sent_row_data[0])));
+    memcpy(&sent_row_data[SCROLL_ROW_LOWER - 1], top_row, sizeof(top_row));
     return;
 }
+#endif
+
+#ifdef DISPLAY_ON_CORE1
+//==============================================================================
+/**
+ * @brief Add a row update to the core 1 ring
+ * 
+ * @param index     row index (0 to 3)
+ * @param row       row data to copy
+ * @return true     added
+ * @return false    ring full
+ */
+static bool display_ring_put(uint8_t index, const struct LCD_row_data_s *row)
+{
+uint32_t    head;
+
+    head = display_ring.head;
+    if ((head - display_ring.tail) >= DISPLAY_RING_SIZE) {
+        return false;
+    }
+    display_ring.entry[head & (DISPLAY_RING_SIZE - 1)].index = index;
+    memcpy(&display_ring.entry[head & (DISPLAY_RING_SIZE - 1)].row, row, sizeof(struct LCD_row_data_s));
+    __dmb();                // entry visible before head moves
+    display_ring.head = head + 1;
+    return true;
+}
 
+//==============================================================================
+/**
+ * @brief Display loop on core 1
+ * 
+ * @note
+ * Owns the SSD1306 : renders row updates from the ring, then flushes
+ * when the ring is empty.  No FreeRTOS calls are made on this core; the
+ * I2C driver polls for end of transfer.  Sleeps (WFE) when idle.
+ */
+static void display_core1_loop(void)
+{
+uint32_t    tail;
+bool        pending;
+
+    SSD1306_init();
+    pending = false;
+    FOREVER {
+        tail = display_ring.tail;
+        if (tail == display_ring.head) {
+            if (pending == true) {
+                SSD1306_flush();
+                pending = false;
+            }
+            __wfe();
+            continue;
+        }
+        __dmb();            // read entry after seeing head
+        LCD_render_row(display_ring.entry[tail & (DISPLAY_RING_SIZE - 1)].index,
+                       &display_ring.entry[tail & (DISPLAY_RING_SIZE - 1)].row);
+        __dmb();            // entry used before slot is released
+        display_ring.tail = tail + 1;
+        pending = true;
+    }
+}
+#endif
@@ -3,6 +3,13 @@
  * @author Jim Herd
  * @brief   Execute motor move commands
  * 
+ * @note
+ * Each command carries the time it was sent. Queue latency is recorded
+ * in a histogram in system_IO_data.motor_cmd_stats. A MOVE command that
+ * has passed its deadline is dropped rather than applied late.
+ *
+ * Task runs above normal priority so that stop commands are applied
+ * ahead of mode and display work. See also emergency_stop().
  */
 #include <string.h>
 
@@ -19,6 +26,36 @@
 
 #include "DRV8833_pwm.h"
 
+//==============================================================================
+/**
+ * @brief Record queue latency of a command
+ * 
+ * @param latency_us    time from send_motor_cmd() to receipt
+ * @param expired       command dropped
+ * @note  Caller must hold semaphore_system_IO_data
+ */
+static void update_motor_cmd_stats(uint32_t latency_us, bool expired)
+{
+uint8_t     bin;
+uint32_t    limit;
+
+    system_IO_data.motor_cmd_stats.commands_received++;
+    if (expired == true) {
+        system_IO_data.motor_cmd_stats.commands_expired++;
+    }
+    if (latency_us > system_IO_data.motor_cmd_stats.max_latency_us) {
+        system_IO_data.motor_cmd_stats.max_latency_us = latency_us;
+    }
+    limit = MOTOR_CMD_LATENCY_BIN_0_US;
+    for (bin = 0; bin < (MOTOR_CMD_LATENCY_BINS - 1); bin++) {
+        if (latency_us < limit) {
+            break;
+        }
+        limit <<= 1;
+    }
+    system_IO_data.motor_cmd_stats.latency_histogram[bin]++;
+}
+
 //==============================================================================
 // Main task routine
 //==============================================================================
@@ -26,34 +63,52 @@ void Task_drive_motors(void *p)
 {
 
 struct motor_cmd_packet_s   command;
-uint32_t                    value;
+uint32_t                    value, latency_us;
+bool                        expired;
+struct emergency_stop_data_s    stop_data;
 uint8_t                     i;
-struct motor_data_s         temp_motor_data;
 TickType_t                  xLastWakeTime;
 TickType_t                  start_time, end_time;
 error_codes_te              error;
 
     DRV8833_init();
+    motor_watchdog_init();
 
     xLastWakeTime = xTaskGetTickCount ();
     FOREVER {
         xQueueReceive(queue_motor_cmds, &command,  portMAX_DELAY);
         start_time = time_us_32();
 
-    // get current motor data
+    // check age of command. Only MOVE commands can expire so that a stop is never lost.
+    // A MOVE sent before an emergency stop is also discarded.
+
+        latency_us = start_time - command.timestamp_us;
+        expired = ((command.cmd == MOVE) &&
+                   (command.deadline_ms != MOTOR_CMD_NO_DEADLINE) &&
+                   (latency_us > (command.deadline_ms * 1000UL)));
+        if (command.cmd == MOVE) {
+            emergency_stop_get_data(&stop_data);
+            if ((stop_data.stop_count > 0) && ((int32_t)(command.timestamp_us - stop_data.stop_time_us) < 0)) {
+                expired = true;
+            }
+        }
 
         xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
-            memcpy(&temp_motor_data, &system_IO_data.push_button_data[command.param1], (sizeof(struct motor_data_s)));
+            update_motor_cmd_stats(latency_us, expired);
         xSemaphoreGive(semaphore_system_IO_data);
 
+        if (expired == true) {
+            continue;
+        }
+
         switch (command.cmd) {
             case MOTOR_OFF   : 
             case MOTOR_BRAKE : 
             case MOVE        : {
+            // DRV8833_set_motor() updates the central system data store
                 error = DRV8833_set_motor(command.param1, command.cmd, command.param2);
                 if (error == OK) {
-                    temp_motor_data.motor_state = command.cmd;
-                    temp_motor_data.pwm_width   = command.param2;
+                    motor_watchdog_feed(command.param1, command.cmd, command.param2);
                 } else {
                     log_error(error, TASK_DRIVE_MOTORS);
                 }
@@ -64,12 +119,6 @@ error_codes_te              error;
             }
         }
 
-    // update central system data store
-
-        xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
-            memcpy(&system_IO_data.push_button_data[command.param1], &temp_motor_data, (sizeof(struct motor_data_s)));
-        xSemaphoreGive(semaphore_system_IO_data);
-
         end_time = time_us_32();
         update_task_execution_time(TASK_DRIVE_MOTORS, start_time, end_time);
     }
@@ -30,7 +30,9 @@ void Task_error(void *p)
 
         xSemaphoreTake(semaphore_system_status, portMAX_DELAY);
             system_status.error_state = error_data.error_message_log[error_data.error_log_ptr].error_code;
+            system_status.generation++;
         xSemaphoreGive(semaphore_system_status);
+        LCD_notify_update();        // error icon
 
     // update circular buffer pointer
     
@@ -0,0 +1,378 @@
+/**
+ * @file    Task_motion.c
+ * @author  Jim Herd
+ * @brief   Execute queued motion primitives
+ *
+ * @note
+ * Modes queue primitives (drive N mm, rotate N degrees, arc of radius R)
+ * with the motion_xxx() calls and carry on.  This task takes them from
+ * the queue in order and runs each one at a fixed rate :
+ *
+ *      1. ramp wheel speed up from MOTION_MIN_SPEED_MM_S
+ *      2. measure progress from the odometry estimate
+ *      3. ramp down as the remaining distance gets small
+ *      4. signal completion through "eventgroup_motion"
+ *
+ * Motors are braked when the queue runs dry, so a sequence of
+ * primitives runs without stopping between each one.
+ *
+ * Expected and actual time of each primitive is kept in
+ * system_IO_data.motion_data to check timing accuracy.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "system.h"
+#include "common.h"
+#include "motion.h"
+#include "odometry.h"
+#include "mixer.h"
+
+#include "pico/stdlib.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "event_groups.h"
+
+//==============================================================================
+// Local data
+//==============================================================================
+
+static volatile uint32_t    queued_count;       // primitives sent to queue
+static volatile uint32_t    completed_count;    // primitives finished or aborted
+static volatile bool        abort_request;
+
+//==============================================================================
+// Local routines
+//==============================================================================
+
+static void queue_primitive(struct motion_primitive_s *primitive)
+{
+    taskENTER_CRITICAL();
+        queued_count++;
+    taskEXIT_CRITICAL();
+    xQueueSend(queue_motion_primitives, primitive, portMAX_DELAY);
+    return;
+}
+
+static void set_wheel_speeds(int32_t linear_mm_s, int32_t differential_mm_s)
+{
+struct mixer_output_s   mixer_output;
+
+    mixer_wheel_speeds(linear_mm_s, differential_mm_s, &mixer_output);
+    send_motor_cmd(MOVE, LEFT_MOTOR, mixer_output.left_pwm, (1000 / TASK_MOTION_FREQUENCY));
+    send_motor_cmd(MOVE, RIGHT_MOTOR, mixer_output.right_pwm, (1000 / TASK_MOTION_FREQUENCY));
+    return;
+}
+
+static void brake_motors(void)
+{
+    send_motor_cmd(MOTOR_BRAKE, LEFT_MOTOR, 0, MOTOR_CMD_NO_DEADLINE);
+    send_motor_cmd(MOTOR_BRAKE, RIGHT_MOTOR, 0, MOTOR_CMD_NO_DEADLINE);
+    return;
+}
+
+static void read_odometry(uint32_t *distance_mm, uint16_t *heading)
+{
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        *distance_mm = system_IO_data.odometry_data.distance_mm;
+        *heading     = system_IO_data.odometry_data.heading;
+    xSemaphoreGive(semaphore_system_IO_data);
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Run one primitive to completion
+ *
+ * @param primitive     primitive from queue
+ * @return true         completed
+ * @return false        aborted by motion_stop() or timeout
+ */
+static bool execute_primitive(struct motion_primitive_s *primitive)
+{
+TickType_t  xLastWakeTime;
+uint32_t    start_distance, distance_now;
+uint16_t    last_heading, heading_now;
+int32_t     target_bam, turned_bam, target_mm, remaining_mm;
+int32_t     speed, max_speed, radius, half_track;
+int32_t     linear, differential;
+uint32_t    start_time, elapsed_ms, expected_ms, timeout_ms;
+bool        turn_left;
+
+    max_speed = abs(primitive->speed_mm_s);
+    if (max_speed == 0) {
+        max_speed = MOTION_DEFAULT_SPEED_MM_S;
+    }
+    if (max_speed > WHEEL_SPEED_AT_FULL_PWM_MM_S) {
+        max_speed = WHEEL_SPEED_AT_FULL_PWM_MM_S;
+    }
+    half_track = WHEEL_TRACK_MM / 2;
+    radius     = abs(primitive->radius_mm);
+    turn_left  = (primitive->angle_degrees >= 0);
+    target_bam = abs(DEGREES_TO_BAM(primitive->angle_degrees));
+
+// length of path followed by the point that sets the speed :
+//      DRIVE  : vehicle centre
+//      ROTATE : each wheel (arc of radius half the track)
+//      ARC    : vehicle centre
+// The mixer scales both wheels down together if the outer wheel of an
+// arc would exceed full speed, so the arc radius is kept.
+
+    switch (primitive->type) {
+        case MOTION_DRIVE :
+            target_mm = abs(primitive->distance_mm);
+            break;
+        case MOTION_ROTATE :
+            target_mm = ((int64_t)target_bam * (int32_t)(2.0 * 3.14159265358979 * WHEEL_TRACK_MM / 2)) >> 16;
+            break;
+        case MOTION_ARC :
+            target_mm = ((int64_t)target_bam * (int32_t)(2.0 * 3.14159265358979 * 1024) * radius) >> 26;
+            break;
+        default :
+            return true;
+    }
+    expected_ms = (target_mm * 1000) / max_speed;
+    timeout_ms  = (expected_ms * MOTION_TIMEOUT_FACTOR) + 1000;
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        system_IO_data.motion_data.state = MOTION_RUNNING;
+        system_IO_data.motion_data.type  = primitive->type;
+    xSemaphoreGive(semaphore_system_IO_data);
+
+    read_odometry(&start_distance, &last_heading);
+    turned_bam = 0;
+    speed      = MOTION_MIN_SPEED_MM_S;
+    start_time = time_us_32();
+
+    xLastWakeTime = xTaskGetTickCount ();
+    FOREVER {
+        if (abort_request == true) {
+            return false;
+        }
+        elapsed_ms = (time_us_32() - start_time) / 1000;
+        if (elapsed_ms > timeout_ms) {
+            log_error(MOTION_PRIMITIVE_TIMEOUT, TASK_MOTION);
+            return false;
+        }
+
+    // measure progress. Heading change is summed as small signed steps so that
+    // turns of more than 180 degrees are handled.
+
+        read_odometry(&distance_now, &heading_now);
+        if (primitive->type == MOTION_DRIVE) {
+            remaining_mm = target_mm - (int32_t)(distance_now - start_distance);
+        } else {
+            turned_bam += (int16_t)(heading_now - last_heading) * (turn_left ? 1 : -1);
+            last_heading = heading_now;
+            remaining_mm = (target_bam <= 0) ? 0 : ((int64_t)target_mm * (target_bam - turned_bam)) / target_bam;
+        }
+        if (remaining_mm <= 0) {
+            break;
+        }
+
+    // trapezoid speed profile
+
+        speed = motion_profile_speed(speed, max_speed, remaining_mm);
+
+    // convert to centre and differential speed for the mixer
+
+        switch (primitive->type) {
+            case MOTION_DRIVE :
+                linear = (primitive->distance_mm < 0) ? -speed : speed;
+                differential = 0;
+                break;
+            case MOTION_ROTATE :
+                linear = 0;
+                differential = speed;
+                break;
+            case MOTION_ARC :
+            default :
+                linear = speed;
+                differential = (speed * half_track) / radius;
+                break;
+        }
+        if (turn_left == false) {
+            differential = -differential;
+        }
+        set_wheel_speeds(linear, differential);
+        xTaskDelayUntil( &xLastWakeTime, TASK_MOTION_FREQUENCY_TICK_COUNT );
+    }
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        system_IO_data.motion_data.expected_time_ms = expected_ms;
+        system_IO_data.motion_data.actual_time_ms   = (time_us_32() - start_time) / 1000;
+    xSemaphoreGive(semaphore_system_IO_data);
+    return true;
+}
+
+//==============================================================================
+// Main task routine
+//==============================================================================
+void Task_motion(void *p)
+{
+struct motion_primitive_s   primitive;
+uint32_t                    start_time, end_time;
+bool                        completed;
+
+    queued_count    = 0;
+    completed_count = 0;
+    abort_request   = false;
+
+    FOREVER {
+        xQueueReceive(queue_motion_primitives, &primitive,  portMAX_DELAY);
+        start_time = time_us_32();
+
+        completed = false;
+        if (abort_request == false) {
+            completed = execute_primitive(&primitive);
+        }
+        if (uxQueueMessagesWaiting(queue_motion_primitives) == 0) {
+            brake_motors();
+        }
+
+        xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+            if (completed == true) {
+                system_IO_data.motion_data.primitives_completed++;
+            } else {
+                system_IO_data.motion_data.primitives_aborted++;
+            }
+            system_IO_data.motion_data.state = MOTION_IDLE;
+        xSemaphoreGive(semaphore_system_IO_data);
+
+        taskENTER_CRITICAL();
+            completed_count++;
+            if (completed_count == queued_count) {
+                abort_request = false;          // queue drained
+            }
+        taskEXIT_CRITICAL();
+        xEventGroupSetBits(eventgroup_motion, MOTION_DONE_EVENT_MASK);
+
+        end_time = time_us_32();
+        update_task_execution_time(TASK_MOTION, start_time, end_time);
+    }
+}
+
+//==============================================================================
+// Motion API
+//==============================================================================
+/**
+ * @brief Queue a straight line move
+ *
+ * @param distance_mm   -ve is backwards
+ * @param speed_mm_s    0 selects MOTION_DEFAULT_SPEED_MM_S
+ */
+void motion_drive(int16_t distance_mm, int16_t speed_mm_s)
+{
+struct motion_primitive_s   primitive;
+
+    primitive.type          = MOTION_DRIVE;
+    primitive.distance_mm   = distance_mm;
+    primitive.angle_degrees = 0;
+    primitive.radius_mm     = 0;
+    primitive.speed_mm_s    = speed_mm_s;
+    queue_primitive(&primitive);
+    return;
+}
+
+/**
+ * @brief Queue a spin on the spot
+ *
+ * @param angle_degrees     +ve is anti-clockwise (left)
+ * @param speed_mm_s        wheel speed, 0 selects MOTION_DEFAULT_SPEED_MM_S
+ */
+void motion_rotate(int16_t angle_degrees, int16_t speed_mm_s)
+{
+struct motion_primitive_s   primitive;
+
+    primitive.type          = MOTION_ROTATE;
+    primitive.distance_mm   = 0;
+    primitive.angle_degrees = angle_degrees;
+    primitive.radius_mm     = 0;
+    primitive.speed_mm_s    = speed_mm_s;
+    queue_primitive(&primitive);
+    return;
+}
+
+/**
+ * @brief Queue a forward arc
+ *
+ * @param radius_mm         radius of path of vehicle centre
+ * @param angle_degrees     +ve is anti-clockwise (left)
+ * @param speed_mm_s        speed of vehicle centre, 0 selects MOTION_DEFAULT_SPEED_MM_S
+ *
+ * @note
+ * A zero radius is a spin on the spot, queued as motion_rotate() with
+ * speed_mm_s as the wheel speed.
+ */
+void motion_arc(int16_t radius_mm, int16_t angle_degrees, int16_t speed_mm_s)
+{
+struct motion_primitive_s   primitive;
+
+    if (radius_mm == 0) {
+        motion_rotate(angle_degrees, speed_mm_s);
+        return;
+    }
+    primitive.type          = MOTION_ARC;
+    primitive.distance_mm   = 0;
+    primitive.angle_degrees = angle_degrees;
+    primitive.radius_mm     = radius_mm;
+    primitive.speed_mm_s    = speed_mm_s;
+    queue_primitive(&primitive);
+    return;
+}
+
+/**
+ * @brief Check for primitives queued or running
+ */
+bool motion_busy(void)
+{
+    return (completed_count != queued_count);
+}
+
+/**
+ * @brief Wait for all queued primitives to finish
+ *
+ * @param time_out      in ticks (portMAX_DELAY to wait forever)
+ * @return true         motion idle
+ * @return false        timed out with motion still running
+ */
+bool motion_wait_idle(TickType_t time_out)
+{
+TickType_t  start_tick, elapsed;
+
+    start_tick = xTaskGetTickCount();
+    while (motion_busy() == true) {
+        elapsed = xTaskGetTickCount() - start_tick;
+        if ((time_out != portMAX_DELAY) && (elapsed >= time_out)) {
+            return false;
+        }
+        xEventGroupWaitBits(eventgroup_motion,
+                            MOTION_DONE_EVENT_MASK,
+                            pdTRUE,         // clear bit
+                            pdFALSE,
+                            (time_out == portMAX_DELAY) ? portMAX_DELAY : (time_out - elapsed));
+    }
+    return true;
+}
+
+/**
+ * @brief Abort running primitive and discard any queued primitives
+ *
+ * @note    Does not wait. Use motion_wait_idle() to wait for motors to brake.
+ *          Busy test and flag set are one critical section, as Task_motion
+ *          clears the flag when the queue drains : a flag set after that
+ *          would drop the next sequence queued.
+ */
+void motion_stop(void)
+{
+    taskENTER_CRITICAL();
+        if (completed_count != queued_count) {
+            abort_request = true;
+        }
+    taskEXIT_CRITICAL();
+    return;
+}
@@ -116,7 +116,9 @@ static struct SNES_gamepad_report_s previous_gamepad_report = { 127,127,0 };
             gamepad_data.button_R      = gamepad_report.button_R;
             gamepad_data.button_START  = gamepad_report.button_START;
             gamepad_data.button_SELECT = gamepad_report.button_SELECT;
+            gamepad_data.generation++;
         xSemaphoreGive(semaphore_gamepad_data);
+        LCD_notify_update();        // gamepad icons
     }
     previous_gamepad_report = gamepad_report;
 }
@@ -141,7 +143,9 @@ uint16_t  vid, pid;
             gamepad_data.state = ENABLED;
             gamepad_data.vid = vid;
             gamepad_data.pid = pid;
+            gamepad_data.generation++;
         xSemaphoreGive(semaphore_gamepad_data);
+        LCD_notify_update();
     if (is_generic_gamepad(dev_addr)) {
         if ( !tuh_hid_receive_report(dev_addr, instance)) {
             log_error(GAMEPAD_ERROR_READING_VID_PID, TASK_ROBOKID);
@@ -166,7 +170,11 @@ void tuh_hid_umount_cb(uint8_t dev_addr, uint8_t instance)
             gamepad_data.state = DISABLED;
             gamepad_data.vid = 0;
             gamepad_data.pid = 0;
+            gamepad_data.dpad_x = GAMEPAD_DPAD_X_AXIS_NULL;     // forget last movement
+            gamepad_data.dpad_y = GAMEPAD_DPAD_Y_AXIS_NULL;
+            gamepad_data.generation++;
         xSemaphoreGive(semaphore_gamepad_data);
+    LCD_notify_update();
 }
 
 //==============================================================================
@@ -10,6 +10,7 @@
 #include "system.h"
 #include "Pico_IO.h"
 #include "common.h"
+#include "odometry.h"
 
 #include "pico/stdlib.h"
 #include "pico/binary_info.h"
@@ -84,7 +85,8 @@ uint8_t     switch_sample_index;
 // 1. read push buttons and debounce
 // 2. read line sensors
 // 3. read analogue sensors
-// 3. update central data store
+// 4. update odometry
+// 5. update central data store
 
 void Task_read_sensors(void *p) 
 {
@@ -93,6 +95,9 @@ BaseType_t  xWasDelayed;
 uint8_t     index;
 uint32_t    start_time, end_time;
 uint32_t    sample_count;
+uint8_t     battery_level;
+bool        battery_changed;
+bool        last_switch_value[NOS_ROBOKID_PUSH_BUTTONS];
 //
 // Task init
 //
@@ -157,10 +162,18 @@ START_PULSE;
         if (switch_sample_index >= NOS_SWITCH_SAMPLES) {
             switch_sample_index = 0;
         }
+        for (index = 0 ; index < NOS_ROBOKID_PUSH_BUTTONS ; index++) {
+            last_switch_value[index] = temp_push_button_data[index].switch_value;
+        }
         temp_push_button_data[0].switch_value = (switch_value & PUSH_BUTTON_A_HARDWARE_MASK) >> PUSH_BUTTON_A_PIN;
         temp_push_button_data[1].switch_value = (switch_value & PUSH_BUTTON_B_HARDWARE_MASK) >> PUSH_BUTTON_B_PIN;
         temp_push_button_data[2].switch_value = (switch_value & PUSH_BUTTON_C_HARDWARE_MASK) >> PUSH_BUTTON_C_PIN;
         temp_push_button_data[3].switch_value = (switch_value & PUSH_BUTTON_D_HARDWARE_MASK) >> PUSH_BUTTON_D_PIN;
+        for (index = 0 ; index < NOS_ROBOKID_PUSH_BUTTONS ; index++) {
+            if ((temp_push_button_data[index].switch_value == true) && (last_switch_value[index] == false)) {
+                temp_push_button_data[index].press_time_us = start_time;    // start of reaction time to a press
+            }
+        }
 
     // set event flags for the four push buttons. Event flags 0 to 3 are set when putton is pressed.
     // Event flags 4 to 7 are set when push button is released
@@ -235,6 +248,10 @@ START_PULSE;
             }
         }
     xSemaphoreGive(semaphore_system_IO_data);
+
+    // Dead-reckoning : integrate wheel speeds at task rate
+
+        odometry_update();
     
     // Update global system data 
 
@@ -242,8 +259,20 @@ START_PULSE;
            memcpy(&system_IO_data.push_button_data[0], &temp_push_button_data[0], (NOS_ROBOKID_PUSH_BUTTONS *  sizeof(struct push_button_data_s)));
            memcpy(&system_IO_data.LED_data[0], &temp_LED_data[0], (NOS_ROBOKID_LEDS * sizeof(struct LED_data_s)));
            memcpy(&system_IO_data.analogue_global_data[0], &temp_analogue_global_data[0] , (NOS_CD4051_CHANNELS * sizeof(struct analogue_global_data_s)));
+           battery_level = battery_icon(temp_analogue_global_data[MOTOR_VOLTAGE_CHANNEL].processed.value);
+           battery_changed = (battery_level != system_IO_data.battery_data.icon);
+           if (battery_changed == true) {
+               system_IO_data.battery_data.icon = battery_level;
+               system_IO_data.battery_data.generation++;
+           }
         xSemaphoreGive(semaphore_system_IO_data);
 
+    // Battery icon only changes at level thresholds : wake display task when it does
+
+        if (battery_changed == true) {
+            LCD_notify_update();
+        }
+
         end_time = time_us_32();
         update_task_execution_time(TASK_READ_SENSORS, start_time, end_time);
         
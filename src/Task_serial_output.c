@@ -1,7 +1,7 @@
 /**
  * @file    Task_serial_output .c
  * @author  Jim Herd
- * @brief   output ASCII strings 
+ * @brief   output ASCII strings and binary telemetry frames
  * 
  * @note
  * Manages the printing of text strings to the com port.
@@ -15,6 +15,9 @@
  * 
  * Method ensures that buffers are used in a safe manner.
  * 
+ * A buffer can also hold a block of binary bytes (see print_bytes) :
+ * these are output unchanged.
+ * 
  */
 #include <string.h>
 
@@ -46,7 +49,13 @@ TickType_t              start_time, end_time;
         xQueueReceive(queue_print_string_buffers, &buffer_index,  portMAX_DELAY);
         start_time = time_us_32();
 
-        printf("%s", print_string_buffers[buffer_index.buffer_index]);
+        if (buffer_index.length == 0) {
+            printf("%s", print_string_buffers[buffer_index.buffer_index]);
+        } else {
+            for (uint32_t i = 0; i < buffer_index.length; i++) {
+                putchar_raw(print_string_buffers[buffer_index.buffer_index][i]);    // no CR/LF translation
+            }
+        }
     
         xQueueSend(queue_free_buffers, &buffer_index, portMAX_DELAY);
         end_time = time_us_32();
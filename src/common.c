@@ -18,6 +18,15 @@
 #include "common.h"
 #include "SSD1306.h"
 #include "Robokid_strings.h"
+#include "DRV8833_pwm.h"
+#include "motion.h"
+
+//==============================================================================
+// Local data
+//==============================================================================
+
+static struct emergency_stop_data_s     emergency_stop_data = {0, 0, 0, 0};
+static bool                             LCD_update_changed;     // protected by semaphore_LCD_data
 
 //==============================================================================
 /**
@@ -62,11 +71,95 @@ struct error_message_s error_message;
     error_message.error_code = error_code;
     error_message.task       = task;
     error_message.log_time   = time_us_64();
-    xQueueSend(queue_motor_cmds, &error_message, portMAX_DELAY);
+    xQueueSend(queue_error_messages, &error_message, portMAX_DELAY);
+
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Time stamp a motor command and send to motor task
+ * 
+ * @param cmd           MOTOR_OFF, MOTOR_BRAKE, or MOVE
+ * @param motor         LEFT_MOTOR or RIGHT_MOTOR
+ * @param pwm_width     -100% to +100%
+ * @param deadline_ms   drop MOVE if queued for longer. MOTOR_CMD_NO_DEADLINE to disable
+ */
+void send_motor_cmd(motor_cmd_t cmd, motor_t motor, int8_t pwm_width, uint16_t deadline_ms)
+{
+struct motor_cmd_packet_s   motor_cmd_packet;
+
+    motor_cmd_packet.cmd          = cmd;
+    motor_cmd_packet.param1       = motor;
+    motor_cmd_packet.param2       = pwm_width;
+    motor_cmd_packet.param3       = 0;
+    motor_cmd_packet.deadline_ms  = deadline_ms;
+    motor_cmd_packet.timestamp_us = time_us_32();
+    xQueueSend(queue_motor_cmds, &motor_cmd_packet, portMAX_DELAY);
 
     return;
 }
 
+//==============================================================================
+/**
+ * @brief Stop both motors immediately
+ * 
+ * Brake is written straight to the PWM hardware, skipping the motor
+ * queue, the zero cross-over delay and the data mutex. A MOVE that the
+ * motor task is part way through is cancelled. Any running motion
+ * primitives are aborted and queued motor commands are thrown away.
+ * Brake commands are then put at the front of the motor queue so that
+ * Task_drive_motors records the new state.
+ * 
+ * @param request_time_us   time_us_32() of the event that asked for the
+ *                          stop (e.g. button press) : latency is measured
+ *                          from this to the brake write
+ */
+void emergency_stop(uint32_t request_time_us)
+{
+struct motor_cmd_packet_s   brake_cmd;
+uint32_t                    request_time, latency;
+
+    request_time = request_time_us;
+    DRV8833_brake_all();
+    latency = time_us_32() - request_time;
+
+    motion_stop();
+    xQueueReset(queue_motor_cmds);
+    brake_cmd.cmd          = MOTOR_BRAKE;
+    brake_cmd.param2       = 0;
+    brake_cmd.param3       = 0;
+    brake_cmd.timestamp_us = request_time;
+    brake_cmd.deadline_ms  = MOTOR_CMD_NO_DEADLINE;
+    brake_cmd.param1       = LEFT_MOTOR;
+    xQueueSendToFront(queue_motor_cmds, &brake_cmd, 0);
+    brake_cmd.param1       = RIGHT_MOTOR;
+    xQueueSendToFront(queue_motor_cmds, &brake_cmd, 0);
+
+    taskENTER_CRITICAL();
+        emergency_stop_data.stop_count++;
+        emergency_stop_data.stop_time_us = request_time;
+        emergency_stop_data.last_latency_us = latency;
+        if (latency > emergency_stop_data.max_latency_us) {
+            emergency_stop_data.max_latency_us = latency;
+        }
+    taskEXIT_CRITICAL();
+
+    return;
+}
+
+/**
+ * @brief Get copy of emergency stop statistics
+ * 
+ * @param data_pt   pointer to destination structure
+ */
+void emergency_stop_get_data(struct emergency_stop_data_s *data_pt)
+{
+    taskENTER_CRITICAL();
+        *data_pt = emergency_stop_data;
+    taskEXIT_CRITICAL();
+}
+
 //==============================================================================
 /**
  * @brief   wait for push buuton to be pressed and released
@@ -155,44 +248,196 @@ void reset_push_button_timers(void)
     return;
 }
 
+//==============================================================================
+/**
+ * @brief Start a multi-row update of the LCD buffer area
+ * 
+ * @note
+ * Takes the LCD data MUTEX, so rows and scroller written with
+ * LCD_update_row() and LCD_update_scroller() are published together :
+ * the display task never shows part of the update.  Every call must be
+ * paired with LCD_update_end(), and no other LCD_ call that takes the
+ * MUTEX (e.g. LCD_write_row) may be made in between.
+ */
+void LCD_update_begin(void)
+{
+    xSemaphoreTake(semaphore_LCD_data, portMAX_DELAY);
+    LCD_update_changed = false;
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Load string into row of LCD buffer area (within an update)
+ * 
+ * String is padded to the width of the font with spaces.  The row is
+ * only marked dirty if its content changes.
+ * 
+ * @param font          font of string
+ * @param row           window in range 1 to 4
+ * @param row_string    string to be displayed
+ * @param invert        true to display as white on black
+ */
+void LCD_update_row(uint8_t font, uint8_t row, const char *row_string, bool invert)
+{
+struct LCD_row_data_s   *row_pt;
+char                    new_row[LCD_ROW_STRING_LENGTH];
+uint8_t                 chars_per_row;
+size_t                  length;
+
+    row_pt = &LCD_row_data[row - 1];
+    chars_per_row = font_data[font].chars_per_row;
+    length = strnlen(row_string, chars_per_row);
+    memcpy(new_row, row_string, length);
+    memset(&new_row[length], ' ', chars_per_row - length);
+    new_row[chars_per_row] = '\0';
+
+    if ((row_pt->font == font) && (row_pt->invert == invert) &&
+        (memcmp(row_pt->row_string, new_row, chars_per_row + 1) == 0)) {
+        return;
+    }
+    memcpy(row_pt->row_string, new_row, chars_per_row + 1);
+    row_pt->font      = font;
+    row_pt->invert    = invert;
+    row_pt->dirty_bit = true;
+    LCD_update_changed = true;
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Load a new set of scroller strings (within an update)
+ * 
+ * @param nos_strings       number of strings (max MAX_SCROLL_STRINGS)
+ * @param scroll_strings    list of strings
+ */
+void LCD_update_scroller(uint8_t nos_strings, const char **scroll_strings)
+{
+    for (uint8_t index = 0; index < nos_strings; index++) {
+        strncpy(LCD_scroll_data.string_data[index], scroll_strings[index], LCD_NOS_ROW_CHARACTERS);
+    }
+    LCD_scroll_data.nos_strings        = nos_strings;
+    LCD_scroll_data.string_count       = 0;
+    LCD_scroll_data.nos_LCD_rows       = SCROLL_AREA_NOS_ROWS;
+    LCD_scroll_data.first_LCD_row      = SCROLL_ROW_UPPER;
+    LCD_scroll_data.scroll_delay_count = 0;
+    LCD_scroll_data.scroll_delay       = SCROLL_DELAY_TICK_COUNT;
+    LCD_scroll_data.restart            = true;
+    LCD_scroll_data.enable             = true;
+    LCD_update_changed = true;
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Finish a multi-row update and wake display task if anything changed
+ */
+void LCD_update_end(void)
+{
+bool    changed;
+
+    changed = LCD_update_changed;
+    xSemaphoreGive(semaphore_LCD_data);
+    if (changed == true) {
+        LCD_notify_update();
+    }
+    return;
+}
+
 //==============================================================================
 /**
  * @brief Load string into row of LCD buffer area
  * 
- * Access to buffer is protected by a MUTEX semaphore
- * This buffer will be output by the display task.
- * String is padded to maximum size with spaces
+ * Single row update : see LCD_update_begin() to change several rows
+ * together.  This buffer will be output by the display task.
  * 
  * @param font          font of string
  * @param row           window in range 1 to 4
- * @param row_string    string to be 
+ * @param row_string    string to be displayed
+ * @param invert        true to display as white on black
  */
 void LCD_write_row(uint8_t font, uint8_t row, const char *row_string, bool invert) 
 {
-bool    end_detect;
-uint8_t row_data_index;
+    LCD_update_begin();
+        LCD_update_row(font, row, row_string, invert);
+    LCD_update_end();
+    return;
+}
 
-    row_data_index = row - 1;
-    end_detect = false;
+//==============================================================================
+/**
+ * @brief Force all LCD rows to be rewritten in full
+ * 
+ * @note
+ * Used after the display has been written outside the row system
+ * (e.g. by a test), so the record of what is on the display is stale.
+ */
+void LCD_refresh_all_rows(void)
+{
     xSemaphoreTake(semaphore_LCD_data, portMAX_DELAY);
-        for (uint8_t index = 0; index < font_data[font].chars_per_row; index++) { 
-            if (end_detect == true) {
-                LCD_row_data[row_data_index].row_string[index] = ' ';
-            } else if (row_string[index] == '\0') {
-                end_detect = true;
-                LCD_row_data[row_data_index].row_string[index] = ' ';
-            } else {
-                LCD_row_data[row_data_index].row_string[index] = row_string[index];
-            }
+        for (uint8_t index = 0; index < SS1306_NOS_LCD_ROWS; index++) {
+            LCD_row_data[index].refresh   = true;
+            LCD_row_data[index].dirty_bit = true;
         }
-        LCD_row_data[row_data_index].row_string[font_data[font].chars_per_row] = '\0';
-        LCD_row_data[row_data_index].font = font;
-        LCD_row_data[row_data_index].dirty_bit = true;
-        LCD_row_data[row_data_index].invert = invert;
     xSemaphoreGive(semaphore_LCD_data);
+    LCD_notify_update();
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Wake display task to show new data
+ * 
+ * Call after changing any data shown on the display (rows, scroller,
+ * or data used by the icon row).  Repeated calls before the display task
+ * runs cost nothing extra.  Calls from the display task itself are
+ * ignored as it is already updating.
+ */
+void LCD_notify_update(void)
+{
+    if ((taskhndl_Task_display_LCD == NULL) || (xTaskGetCurrentTaskHandle() == taskhndl_Task_display_LCD)) {
+        return;
+    }
+    xTaskNotifyGiveIndexed(taskhndl_Task_display_LCD, LCD_UPDATE_NOTIFY_INDEX);
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Set class of screen being shown : selects display update rate
+ * 
+ * @param refresh_class     LCD_CLASS_MENU for text, LCD_CLASS_LIVE for plots and gauges
+ * 
+ * @note
+ * Single byte write, only read by the display task, so no MUTEX.
+ */
+void LCD_set_refresh_class(LCD_class_te refresh_class)
+{
+    LCD_refresh_class = refresh_class;
     return;
 }
 
+//==============================================================================
+/**
+ * @brief Select battery icon for a battery voltage reading
+ * 
+ * @param battery_volts     A/D value of MOTOR_VOLTAGE_CHANNEL
+ * @return uint8_t          BATTERY_FULL to BATTERY_EMPTY
+ */
+uint8_t battery_icon(uint16_t battery_volts)
+{
+    if (battery_volts > V_BATT_100_PERCENT) {
+        return BATTERY_FULL;
+    } else if (battery_volts > V_BATT_75_PERCENT) {
+        return BATTERY_75;
+    } else if (battery_volts > V_BATT_50_PERCENT) {
+        return BATTERY_HALF;
+    } else if (battery_volts > V_BATT_25_PERCENT) {
+        return BATTERY_25;
+    }
+    return BATTERY_EMPTY;
+}
+
 //==============================================================================
 /**
  * @brief Set the tune data object
@@ -303,10 +548,38 @@ struct string_buffer_s free_buffer_index;
     uint32_t index = free_buffer_index.buffer_index;
 
     strncpy(print_string_buffers[index], string_pt, (STRING_LENGTH-1));
+    free_buffer_index.length = 0;
     
     xQueueSend(queue_print_string_buffers, &free_buffer_index, portMAX_DELAY);
 
     return;
 }
 
+//==============================================================================
+/**
+ * @brief send block of binary bytes to print task
+ * 
+ * As print_string, but bytes are output unchanged (no '\0' or line end
+ * processing).  Used for binary telemetry frames.
+ * 
+ * @param data 
+ * @param length    number of bytes (max STRING_LENGTH)
+ */
+void print_bytes(const uint8_t *data, uint32_t length)
+{
+struct string_buffer_s free_buffer_index;
+
+    if ((length == 0) || (length > STRING_LENGTH)) {
+        return;
+    }
+    xQueueReceive(queue_free_buffers, &free_buffer_index,  portMAX_DELAY);
+
+    memcpy(print_string_buffers[free_buffer_index.buffer_index], data, length);
+    free_buffer_index.length = length;
+
+    xQueueSend(queue_print_string_buffers, &free_buffer_index, portMAX_DELAY);
+
+    return;
+}
+
 
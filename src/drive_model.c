@@ -0,0 +1,191 @@
+/**
+ * @file    drive_model.c
+ * @author  Jim Herd
+ * @brief   Integer model of the differential drive
+ *
+ * @note
+ * Motor model (PWM width <-> wheel speed), the pose integration step
+ * used by the odometry, the motion primitive speed profile and the motor
+ * watchdog timeout test.  All arithmetic is integer.  Each step is a fixed
+ * sequence of adds, multiplies and one table look-up, so CPU cost is
+ * constant.  Integration uses the heading at the middle of the tick,
+ * which is exact for straight lines and spins and has second order
+ * error on arcs.
+ *
+ * No Pico SDK or FreeRTOS calls : tools/host_tests builds this file on
+ * a host and checks it against a floating point model.
+ */
+
+#include <stdlib.h>
+
+#include "drive_model.h"
+
+//==============================================================================
+// Quarter wave sine table : 65 entries for 0 to 90 degrees, Q15 format
+//==============================================================================
+
+static const int16_t quarter_sine[65] = {
+        0,   804,  1608,  2410,  3212,  4011,  4808,  5602,
+     6393,  7179,  7962,  8739,  9512, 10278, 11039, 11793,
+    12539, 13279, 14010, 14732, 15446, 16151, 16846, 17530,
+    18204, 18868, 19519, 20159, 20787, 21403, 22005, 22594,
+    23170, 23731, 24279, 24811, 25329, 25832, 26319, 26790,
+    27245, 27683, 28105, 28510, 28898, 29268, 29621, 29956,
+    30273, 30571, 30852, 31113, 31356, 31580, 31785, 31971,
+    32137, 32285, 32412, 32521, 32609, 32678, 32728, 32757,
+    32767,
+};
+
+//==============================================================================
+/**
+ * @brief Convert a PWM width to an estimated wheel speed
+ *
+ * @param pwm_width     -100% to +100%
+ * @return int16_t      wheel speed in mm/S (+ve is forward)
+ */
+int16_t wheel_speed_mm_s(int8_t pwm_width)
+{
+int32_t     width;
+
+    width = abs(pwm_width);
+    if (width <= MOTOR_DEADBAND_PERCENT) {
+        return 0;
+    }
+    if (width > 100) {
+        width = 100;
+    }
+    width = ((width - MOTOR_DEADBAND_PERCENT) * WHEEL_SPEED_AT_FULL_PWM_MM_S) / (100 - MOTOR_DEADBAND_PERCENT);
+    return (pwm_width < 0) ? -width : width;
+}
+
+//==============================================================================
+/**
+ * @brief Convert a wheel speed to a PWM width (inverse of wheel_speed_mm_s)
+ *
+ * @param speed_mm_s    wheel speed in mm/S (+ve is forward)
+ * @return int8_t       -100% to +100%, rounded to nearest 1%
+ */
+int8_t wheel_pwm_for_speed(int16_t speed_mm_s)
+{
+int32_t     width;
+
+    if (speed_mm_s == 0) {
+        return 0;
+    }
+    width = MOTOR_DEADBAND_PERCENT +
+            ((abs(speed_mm_s) * (100 - MOTOR_DEADBAND_PERCENT)) + (WHEEL_SPEED_AT_FULL_PWM_MM_S / 2)) / WHEEL_SPEED_AT_FULL_PWM_MM_S;
+    if (width > 100) {
+        width = 100;
+    }
+    return (speed_mm_s < 0) ? -width : width;
+}
+
+//==============================================================================
+/**
+ * @brief sine of a binary angle
+ *
+ * @param angle     65536 = 360 degrees
+ * @return int16_t  Q15 format (32767 = 1.0)
+ */
+int16_t odometry_sin(uint16_t angle)
+{
+uint16_t    quadrant, offset, index, fraction;
+int32_t     value;
+
+    quadrant = angle >> 14;
+    offset   = angle & 0x3FFF;
+    if (quadrant & 1) {
+        offset = 0x4000 - offset;       // 90 to 180 degrees is a mirror of 0 to 90
+    }
+    index    = offset >> 8;
+    fraction = offset & 0xFF;
+    value = quarter_sine[index];
+    if (index < 64) {
+        value += ((quarter_sine[index + 1] - value) * fraction) >> 8;
+    }
+    return (quadrant & 2) ? -value : value;
+}
+
+//==============================================================================
+/**
+ * @brief cosine of a binary angle
+ *
+ * @param angle     65536 = 360 degrees
+ * @return int16_t  Q15 format (32767 = 1.0)
+ */
+int16_t odometry_cos(uint16_t angle)
+{
+    return odometry_sin(angle + 0x4000);
+}
+
+//==============================================================================
+/**
+ * @brief Integrate wheel speeds over one odometry period
+ *
+ * @param pose          pose to update
+ * @param left_speed    wheel speeds in mm/S (+ve is forward)
+ * @param right_speed
+ */
+void odometry_step(struct pose_s *pose, int16_t left_speed, int16_t right_speed)
+{
+int32_t     delta_s_um, delta_heading, delta_x, delta_y;
+uint16_t    mid_heading;
+
+// distance moved by vehicle centre and change in heading (right wheel faster => turn left)
+
+    delta_s_um    = ((left_speed + right_speed) * ODOMETRY_UM_PER_MM_S) / 2;
+    delta_heading = (right_speed - left_speed) * ODOMETRY_HEADING_PER_MM_S;
+
+// integrate using heading at middle of tick
+
+    mid_heading = (pose->heading + (delta_heading / 2)) >> 16;
+    delta_x = ((delta_s_um * odometry_cos(mid_heading)) + (1 << 14)) >> 15;
+    delta_y = ((delta_s_um * odometry_sin(mid_heading)) + (1 << 14)) >> 15;
+    pose->x_um += delta_x;
+    pose->y_um += delta_y;
+    pose->heading += delta_heading;
+
+    pose->distance_um += abs(delta_s_um);
+    while (pose->distance_um >= 1000) {
+        pose->distance_um -= 1000;
+        pose->distance_mm++;
+    }
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Next speed of the trapezoid profile of a motion primitive
+ *
+ * @param speed         speed set last tick, mm/S
+ * @param max_speed     cruise speed, mm/S
+ * @param remaining_mm  distance still to go
+ * @return int32_t      speed for this tick, mm/S
+ */
+int32_t motion_profile_speed(int32_t speed, int32_t max_speed, int32_t remaining_mm)
+{
+int32_t     limit;
+
+    speed += MOTION_ACCEL_MM_S_PER_TICK;
+    if (speed > max_speed) {
+        speed = max_speed;
+    }
+    limit = MOTION_MIN_SPEED_MM_S + (remaining_mm * MOTION_SLOWDOWN_GAIN);
+    if (speed > limit) {
+        speed = limit;
+    }
+    return speed;
+}
+
+//==============================================================================
+/**
+ * @brief Motor watchdog timeout test, called every MOTOR_WATCHDOG_CHECK_MS
+ *
+ * @param running       true if either motor is running
+ * @param silence_us    time since last applied motor command (wraps safely)
+ * @return true         brake the motors
+ */
+bool motor_watchdog_expired(bool running, uint32_t silence_us)
+{
+    return ((running == true) && (silence_us > (MOTOR_WATCHDOG_TIMEOUT_MS * 1000)));
+}
@@ -38,6 +38,7 @@ TaskHandle_t taskhndl_Task_read_sensors;
 TaskHandle_t taskhndl_Task_read_gamepad;
 TaskHandle_t taskhndl_Task_display_LCD;
 TaskHandle_t taskhndl_Task_drive_motors;
+TaskHandle_t taskhndl_Task_motion;
 TaskHandle_t taskhndl_Task_error;
 TaskHandle_t taskhndl_Task_sounder;
 TaskHandle_t taskhndl_Task_serial_output;
@@ -52,11 +53,13 @@ SemaphoreHandle_t semaphore_gamepad_data;
 SemaphoreHandle_t semaphore_tune_data;
 
 QueueHandle_t queue_motor_cmds;
+QueueHandle_t queue_motion_primitives;
 QueueHandle_t queue_error_messages;
 QueueHandle_t queue_print_string_buffers;
 QueueHandle_t queue_free_buffers;
 
 EventGroupHandle_t eventgroup_push_buttons;
+EventGroupHandle_t eventgroup_motion;
 
 //==============================================================================
 // System data structures. Protected with MUTEXES
@@ -71,8 +74,12 @@ struct error_data_s        error_data;
 struct font_data_s         font_data[NOS_FONTS] = {
     {Terminal_9x16,                (SSD1306_LCDWIDTH / TERMINAL_9x16_FONT_WIDTH)},              // font 0
     {robokid_LCD_icons_font_15x16, (SSD1306_LCDWIDTH / ROBOKID_LCD_ICONS_FONT_15x16_WIDTH)},    // font 1
+    {Terminal_12x16,               (SSD1306_LCDWIDTH / TERMINAL_12x16_FONT_WIDTH)},             // font 2
+    {Font_6x8,                     (SSD1306_LCDWIDTH / FONT_6x8_WIDTH)},                        // font 3
+    {Segment_25x40,                (SSD1306_LCDWIDTH / SEGMENT_25x40_FONT_WIDTH)},              // font 4
 };
 struct LCD_row_data_s      LCD_row_data[SS1306_NOS_LCD_ROWS];
+LCD_class_te               LCD_refresh_class = LCD_CLASS_MENU;
 
 // ASCII string buffers
 
@@ -97,6 +104,8 @@ uint8_t     index;
         system_status.error_state = OK;
     // Battery voltage
         system_IO_data.system_voltage = 500;
+        system_IO_data.battery_data.icon = BATTERY_EMPTY;
+        system_IO_data.battery_data.generation = 0;
     // CD4051 channel data
         for (index=0; index < NOS_CD4051_CHANNELS ; index++ ) {
             system_IO_data.analogue_global_data[index].active = true;
@@ -125,6 +134,13 @@ uint8_t     index;
         system_IO_data.motor_data[RIGHT_MOTOR].motor_state = OFF;
         system_IO_data.motor_data[RIGHT_MOTOR].pwm_width = 0;
         system_IO_data.motor_data[RIGHT_MOTOR].flip = RIGHT_MOTOR_FLIP_MODE;
+    // Motor command statistics
+        system_IO_data.motor_cmd_stats.commands_received = 0;
+        system_IO_data.motor_cmd_stats.commands_expired = 0;
+        system_IO_data.motor_cmd_stats.max_latency_us = 0;
+        for (index=0 ; index < MOTOR_CMD_LATENCY_BINS ; index++) {
+            system_IO_data.motor_cmd_stats.latency_histogram[index] = 0;
+        }
     // Push button data
         for (index=0; index < NOS_ROBOKID_PUSH_BUTTONS ; index++ ) {
             system_IO_data.push_button_data[index].switch_value = false;
@@ -151,6 +167,22 @@ uint8_t     index;
     // Vehicle data
         system_IO_data.vehicle_data.vehicle_state = STOPPED;
         system_IO_data.vehicle_data.speed = 0;
+    // Odometry data
+        system_IO_data.odometry_data.x_mm = 0;
+        system_IO_data.odometry_data.y_mm = 0;
+        system_IO_data.odometry_data.heading = 0;
+        system_IO_data.odometry_data.heading_degrees = 0;
+        system_IO_data.odometry_data.left_speed_mm_s = 0;
+        system_IO_data.odometry_data.right_speed_mm_s = 0;
+        system_IO_data.odometry_data.speed_mm_s = 0;
+        system_IO_data.odometry_data.distance_mm = 0;
+        system_IO_data.odometry_data.update_count = 0;
+    // Motion data
+        system_IO_data.motion_data.state = MOTION_IDLE;
+        system_IO_data.motion_data.primitives_completed = 0;
+        system_IO_data.motion_data.primitives_aborted = 0;
+        system_IO_data.motion_data.expected_time_ms = 0;
+        system_IO_data.motion_data.actual_time_ms = 0;
     // Task execution data
         for (index=0 ; index < NOS_TASKS ; index++) {
             system_IO_data.task_data[index].priority = TASK_PRIORITYNORMAL;
@@ -163,6 +195,7 @@ uint8_t     index;
             LCD_row_data[index].dirty_bit   = false;
             LCD_row_data[index].font        = 0;
             LCD_row_data[index].invert      = false;
+            LCD_row_data[index].refresh     = false;
         };
 }
 //==============================================================================
@@ -201,10 +234,20 @@ int main()
                 "Drive_motors_task",
                 configMINIMAL_STACK_SIZE,
                 NULL,
-                TASK_PRIORITYNORMAL,
+                TASK_PRIORITYABOVENORMAL,       // stop commands take effect before other work
                 &taskhndl_Task_drive_motors
     );
     system_IO_data.task_data[TASK_DRIVE_MOTORS].task_handle = taskhndl_Task_drive_motors;
+    system_IO_data.task_data[TASK_DRIVE_MOTORS].priority = TASK_PRIORITYABOVENORMAL;
+
+    xTaskCreate(Task_motion,
+                "Motion_task",
+                configMINIMAL_STACK_SIZE,
+                NULL,
+                TASK_PRIORITYNORMAL,
+                &taskhndl_Task_motion
+    );
+    system_IO_data.task_data[TASK_MOTION].task_handle = taskhndl_Task_motion;
 
     xTaskCreate(Task_read_sensors,
                 "Read_sensors_task",
@@ -286,11 +329,13 @@ int main()
     semaphore_tune_data         = xSemaphoreCreateMutex();
 
     queue_motor_cmds     = xQueueCreate(MOTOR_CMD_QUEUE_LENGTH, sizeof(struct motor_cmd_packet_s));   
+    queue_motion_primitives = xQueueCreate(MOTION_QUEUE_LENGTH, sizeof(struct motion_primitive_s));
     queue_error_messages = xQueueCreate(ERROR_MESSAGE_QUEUE_LENGTH, sizeof(struct error_message_s));
     queue_print_string_buffers = xQueueCreate(NOS_PRINT_STRING_BUFFERS+1, sizeof(struct string_buffer_s));
     queue_free_buffers   = xQueueCreate(NOS_PRINT_STRING_BUFFERS+1, sizeof(struct string_buffer_s));
 
     eventgroup_push_buttons = xEventGroupCreate (); 
+    eventgroup_motion       = xEventGroupCreate ();
 
     prime_free_buffer_queue();
 
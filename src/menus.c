@@ -16,6 +16,8 @@
 
 #include "run_gamepad_modes.h"
 #include "run_bump_modes.h"
+#include "run_activity_modes.h"
+#include "run_lab_modes.h"
 #include "run_test_modes.h"
 
 //==============================================================================
@@ -38,12 +40,12 @@ struct menu primary_menu = {
     },
     {
         run_gamepad_modes,
-        null_function,
+        run_activity_modes,
         run_bump_modes,
         null_function,
         null_function,
         null_function,
-        null_function,
+        run_lab_modes,
         null_function,
         run_test_modes,
     }
@@ -79,18 +81,42 @@ struct menu gamepad_mode_menu = {
 
 struct menu test_mode_menu = {
     false,
-    4,
+    16,
     {
         "   Test 0     ",
         "   Test 1     ",
         "   Test 2     ",
         "   Test 3     ",  
+        "   Test 4     ",  
+        "   Test 5     ",  
+        "   Test 6     ",  
+        "   Test 7     ",  
+        "   Test 8     ",  
+        "   Test 9     ",  
+        "   Test 10    ",  
+        "   Test 11    ",  
+        "   Test 12    ",  
+        "   Test 13    ",  
+        "   Test 14    ",  
+        "   Test 15    ",  
     },
     {   
         run_test_0, 
         run_test_1,
         run_test_2_menu,
         run_test_3,
+        run_test_4,
+        run_test_5,
+        run_test_6,
+        run_test_7,
+        run_test_8,
+        run_test_9,
+        run_test_10,
+        run_test_11,
+        run_test_12,
+        run_test_13,
+        run_test_14,
+        run_test_15,
     }
 };
 
@@ -137,8 +163,10 @@ error_codes_te      error;
     mode_index = 0;
 
     FOREVER {
-        LCD_write_row(0, MESSAGE_ROW, menu_pt->mode_strings[mode_index], true);
-        SSD1306_set_text_area_scroller(STRING_COUNT(menu_button_data), menu_button_data);
+        LCD_update_begin();
+            LCD_update_row(0, MESSAGE_ROW, menu_pt->mode_strings[mode_index], true);
+            LCD_update_scroller(STRING_COUNT(menu_button_data), menu_button_data);
+        LCD_update_end();
         set_leds(LED_ON, LED_ON, LED_ON, LED_ON);
         event_bits = (wait_for_any_button_press(portMAX_DELAY) & PUSH_BUTTON_ON_EVENT_MASK);
 
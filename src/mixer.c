@@ -0,0 +1,92 @@
+/**
+ * @file    mixer.c
+ * @author  Jim Herd
+ * @brief   Differential drive mixer
+ *
+ * @note
+ * Converts a vehicle motion request into left/right PWM widths.
+ * All paths reduce to a centre speed v and a differential speed d :
+ *
+ *      left  = v - d
+ *      right = v + d           (d > 0 turns left)
+ *
+ * If either wheel would exceed WHEEL_SPEED_AT_FULL_PWM_MM_S, both are
+ * scaled by the same factor.  This keeps the curvature of the path and
+ * gives up speed instead.  Wheel speeds are then converted to PWM with
+ * wheel_pwm_for_speed(), which includes the motor deadband, so the
+ * mixer and the odometry estimate use the same motor model.
+ *
+ * Integer arithmetic only.
+ */
+
+#include <stdlib.h>
+
+#include "system.h"
+#include "mixer.h"
+#include "odometry.h"
+
+//==============================================================================
+/**
+ * @brief Mix centre and differential speed into wheel PWM widths
+ *
+ * @param linear_mm_s           speed of vehicle centre (+ve is forward)
+ * @param differential_mm_s     half the right-left speed difference (+ve turns left)
+ * @param output                PWM widths and saturation flag
+ */
+void mixer_wheel_speeds(int32_t linear_mm_s, int32_t differential_mm_s, struct mixer_output_s *output)
+{
+int32_t     left, right, peak;
+
+    left  = linear_mm_s - differential_mm_s;
+    right = linear_mm_s + differential_mm_s;
+
+    peak = (abs(left) > abs(right)) ? abs(left) : abs(right);
+    output->saturated = (peak > WHEEL_SPEED_AT_FULL_PWM_MM_S);
+    if (output->saturated == true) {
+        left  = (left  * WHEEL_SPEED_AT_FULL_PWM_MM_S) / peak;
+        right = (right * WHEEL_SPEED_AT_FULL_PWM_MM_S) / peak;
+    }
+    output->left_pwm  = wheel_pwm_for_speed(left);
+    output->right_pwm = wheel_pwm_for_speed(right);
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Mix throttle and curvature
+ *
+ * Curvature scales with throttle, so the path shape does not change
+ * with speed.  Zero throttle always gives stop.
+ *
+ * @param throttle      Q15, -1.0 to +1.0 of full speed
+ * @param curvature     Q14, +ve turns left. 1.0 stops the inside wheel
+ * @param output        PWM widths and saturation flag
+ */
+void mixer_throttle_curvature(int16_t throttle, int16_t curvature, struct mixer_output_s *output)
+{
+int32_t     linear, differential;
+
+    linear       = (throttle * WHEEL_SPEED_AT_FULL_PWM_MM_S) >> 15;
+    differential = (linear * curvature) >> 14;
+    mixer_wheel_speeds(linear, differential, output);
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Mix linear and angular velocity
+ *
+ * @param linear_mm_s           speed of vehicle centre (+ve is forward)
+ * @param angular_degrees_s     rate of turn (+ve is anti-clockwise)
+ * @param output                PWM widths and saturation flag
+ */
+void mixer_linear_angular(int16_t linear_mm_s, int16_t angular_degrees_s, struct mixer_output_s *output)
+{
+int32_t     differential;
+
+// wheel speed difference is  omega * track / 2 , omega in radians/S
+
+    differential = (angular_degrees_s * (int32_t)(3.14159265358979 * WHEEL_TRACK_MM * 1024 / 360)) >> 10;
+    mixer_wheel_speeds(linear_mm_s, differential, output);
+    return;
+}
@@ -0,0 +1,83 @@
+/**
+ * @file    odometry.c
+ * @author  Jim Herd
+ * @brief   Dead-reckoning odometry for the differential drive
+ *
+ * @note
+ * Robokid has no wheel encoders, so wheel speeds are estimated from the
+ * PWM width of each motor (see wheel_speed_mm_s).  The estimate is
+ * integrated into an (x,y,heading) pose at the fixed rate of the sensor
+ * task.  The motor model and integration step are in drive_model.c;
+ * this file reads the motor state and publishes the pose.
+ */
+
+#include "system.h"
+#include "odometry.h"
+#include "DRV8833_pwm.h"
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+//==============================================================================
+// Local data
+//==============================================================================
+
+static struct pose_s   pose;
+static uint32_t        update_count;
+
+//==============================================================================
+/**
+ * @brief Set vehicle pose to origin, pointing along X axis
+ */
+void odometry_reset(void)
+{
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        pose.x_um = 0; pose.y_um = 0;
+        pose.heading = 0;
+        pose.distance_mm = 0; pose.distance_um = 0;
+        system_IO_data.odometry_data.x_mm = 0;
+        system_IO_data.odometry_data.y_mm = 0;
+        system_IO_data.odometry_data.heading = 0;
+        system_IO_data.odometry_data.heading_degrees = 0;
+        system_IO_data.odometry_data.distance_mm = 0;
+    xSemaphoreGive(semaphore_system_IO_data);
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Integrate wheel speeds over one sensor task period
+ *
+ * Called at ODOMETRY_FREQUENCY by the sensor task.
+ */
+void odometry_update(void)
+{
+int8_t      left_pwm, right_pwm;
+int16_t     left_speed, right_speed;
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        left_pwm  = system_IO_data.motor_data[LEFT_MOTOR].pwm_width;
+        right_pwm = system_IO_data.motor_data[RIGHT_MOTOR].pwm_width;
+    xSemaphoreGive(semaphore_system_IO_data);
+
+    left_speed  = wheel_speed_mm_s(left_pwm);
+    right_speed = wheel_speed_mm_s(right_pwm);
+    odometry_step(&pose, left_speed, right_speed);
+    update_count++;
+
+// publish
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        system_IO_data.odometry_data.x_mm             = pose.x_um / 1000;
+        system_IO_data.odometry_data.y_mm             = pose.y_um / 1000;
+        system_IO_data.odometry_data.heading          = pose.heading >> 16;
+        system_IO_data.odometry_data.heading_degrees  = BAM_TO_DEGREES(pose.heading >> 16);
+        system_IO_data.odometry_data.left_speed_mm_s  = left_speed;
+        system_IO_data.odometry_data.right_speed_mm_s = right_speed;
+        system_IO_data.odometry_data.speed_mm_s       = (left_speed + right_speed) / 2;
+        system_IO_data.odometry_data.distance_mm      = pose.distance_mm;
+        system_IO_data.odometry_data.update_count     = update_count;
+        set_vehicle_state();
+    xSemaphoreGive(semaphore_system_IO_data);
+    return;
+}
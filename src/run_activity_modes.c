@@ -0,0 +1,102 @@
+/**
+ * @file run_activity_modes.c
+ * @author Jim Herd
+ * @brief Implement simple pre-programmed movement activities
+ */
+
+// Notes
+//      Each activity is a sequence of motion primitives that are queued
+//      in one go. Task_motion executes them in turn.
+//
+//      Active switches are 
+//          switch A = go
+//          switch D = emergency stop
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "system.h"
+#include "common.h"
+#include "SSD1306.h"
+#include "Robokid_strings.h"
+#include "run_activity_modes.h"
+#include "menus.h"
+#include "motion.h"
+
+#include "FreeRTOS.h"
+#include "event_groups.h"
+
+//==============================================================================
+
+enum a_modes {A_RUN_FORWARD, A_RUN_BACKWARD, A_SPIN_RIGHT, A_SPIN_LEFT, A_SQUARE};
+
+struct menu activity_mode_menu = {
+    false,
+    5,
+    {
+        " Run forward  ",
+        " Run backward ",
+        " Spin right   ",
+        " Spin left    ",
+        " Square       ",
+    },
+    {   
+        execute_activity, 
+        execute_activity,
+        execute_activity,
+        execute_activity,
+        execute_activity,
+    }
+};
+
+//==============================================================================
+
+error_codes_te run_activity_modes(uint8_t mode_index, uint32_t parameter) 
+{
+    return run_menu(&activity_mode_menu);
+}
+
+error_codes_te execute_activity(uint8_t mode_index, uint32_t  parameter)
+{
+uint32_t    press_time;
+
+    SSD1306_set_text_area_scroller(STRING_COUNT(mode_A_button_data), mode_A_button_data);
+    wait_for_button_press(PUSH_BUTTON_A, portMAX_DELAY);
+
+    switch (mode_index) {
+        case A_RUN_FORWARD : 
+            motion_drive(+500, MOTION_DEFAULT_SPEED_MM_S);
+            break;
+        case A_RUN_BACKWARD : 
+            motion_drive(-500, MOTION_DEFAULT_SPEED_MM_S);
+            break;
+        case A_SPIN_RIGHT : 
+            motion_rotate(-360, MOTION_DEFAULT_SPEED_MM_S);
+            break;
+        case A_SPIN_LEFT : 
+            motion_rotate(+360, MOTION_DEFAULT_SPEED_MM_S);
+            break;
+        case A_SQUARE : 
+            for (uint8_t side = 0; side < 4; side++) {
+                motion_drive(+300, MOTION_DEFAULT_SPEED_MM_S);
+                motion_rotate(+90, MOTION_DEFAULT_SPEED_MM_S);
+            }
+            break;
+        default :
+            break;
+    }
+
+// wait for sequence to finish, D button aborts
+
+    while (motion_wait_idle(100/portTICK_PERIOD_MS) == false) {
+        if (xEventGroupGetBits(eventgroup_push_buttons) & PUSH_BUTTON_D_EVENT_MASK) {
+            xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+                press_time = system_IO_data.push_button_data[PUSH_BUTTON_D].press_time_us;
+            xSemaphoreGive(semaphore_system_IO_data);
+            emergency_stop(press_time);
+            motion_wait_idle(portMAX_DELAY);    // aborted primitives drain
+            break;
+        }
+    }
+    return OK;
+}
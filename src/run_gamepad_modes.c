@@ -19,6 +19,7 @@
 #include "Robokid_strings.h"
 #include "run_gamepad_modes.h"
 #include "menus.h"
+#include "mixer.h"
 
 #include "FreeRTOS.h"
 
@@ -73,9 +74,10 @@ error_codes_te run_gamepad_modes(uint8_t mode_index, uint32_t parameter)
  * @brief Run Robokid vehicle with DPAD control
  * 
  * DPAD : forward, backward, left, right
+ *        diagonals give smooth arcs in mode 1
  * SELECT : exit this mode
  * 
- * @param mode   gamepad mode
+ * @param mode_index   gamepad mode (menu entry) : GAMEPAD_MODE_0 or GAMEPAD_MODE_1
  * 
  * @note
  * The same motor packet command structure is used to send both right
@@ -86,10 +88,12 @@ error_codes_te run_gamepad_modes(uint8_t mode_index, uint32_t parameter)
 error_codes_te execute_gamepad_activities(uint8_t mode_index, uint32_t  parameter)
 {
 struct gamepad_data_s       temp_gamepad_data;
-struct motor_cmd_packet_s   motor_cmd_packet;
 uint32_t                    DPAD_code;
 uint8_t                     left_cmd, right_cmd;
 int8_t                      left_PWM, right_PWM;
+int16_t                     throttle, curvature;
+struct mixer_output_s       mixer_output;
+bool                        arc;
 
     SSD1306_set_text_area_scroller(STRING_COUNT(gamepad_connect), gamepad_connect);
     wait_for_button_press(PUSH_BUTTON_A, portMAX_DELAY);
@@ -108,11 +112,17 @@ int8_t                      left_PWM, right_PWM;
         if (temp_gamepad_data.button_SELECT == true) {
             break;
         }
+        if (temp_gamepad_data.state == DISABLED) {      // gamepad unplugged
+            emergency_stop(time_us_32());
+            return USB_CONTROLLER_NOT_CONNECTED;
+        }
 
 // calculate motor commands
 
         DPAD_code = ((temp_gamepad_data.dpad_x << 8) + temp_gamepad_data.dpad_y);
 
+        right_cmd = MOTOR_BRAKE; left_cmd = MOTOR_BRAKE;    // for unused dpad codes
+        right_PWM = 0; left_PWM = 0;
         if (DPAD_code == DPAD_STOP) {
             right_cmd = MOTOR_BRAKE; left_cmd = MOTOR_BRAKE; 
             right_PWM = 0; left_PWM = 0;
@@ -129,40 +139,41 @@ int8_t                      left_PWM, right_PWM;
             right_cmd = MOVE; left_cmd = MOVE;
             right_PWM = +GAMEPAD_MODE_0_SLOW_SPEED; left_PWM = -GAMEPAD_MODE_0_SLOW_SPEED;
         } 
-        if (parameter == GAMEPAD_MODE_1) {
+        arc = false;
+        if (mode_index == GAMEPAD_MODE_1) {
+            throttle  = (temp_gamepad_data.button_Y == true) ? GAMEPAD_MODE_1_FAST_THROTTLE : GAMEPAD_MODE_1_SLOW_THROTTLE;
+            curvature = GAMEPAD_MODE_1_ARC_CURVATURE;
+            arc = true;
             if (DPAD_code == ARC_FORWARD_RIGHT) {
-                right_cmd = MOTOR_BRAKE; left_cmd = MOVE;
-                right_PWM = 0; left_PWM = +GAMEPAD_MODE_0_SLOW_SPEED;
+                curvature = -curvature;
             } else if (DPAD_code == ARC_FORWARD_LEFT) {
-                right_cmd = MOVE; left_cmd = MOTOR_BRAKE;
-                right_PWM = +GAMEPAD_MODE_0_SLOW_SPEED; left_PWM = 0;
+                ;
             } else if (DPAD_code == ARC_BACKWARD_RIGHT) {
-                right_cmd = MOTOR_BRAKE; left_cmd = MOVE;
-                right_PWM = 0; left_PWM = -GAMEPAD_MODE_0_SLOW_SPEED;
+                throttle = -throttle; curvature = -curvature;
             } else if (DPAD_code == ARC_BACKWARD_LEFT) {
-                right_cmd = MOVE; left_cmd = MOTOR_BRAKE;
-                right_PWM = -GAMEPAD_MODE_0_SLOW_SPEED; left_PWM = 0;
+                throttle = -throttle;
+            } else {
+                arc = false;
+            }
+            if (arc == true) {
+                mixer_throttle_curvature(throttle, curvature, &mixer_output);
+                right_cmd = MOVE; left_cmd = MOVE;
+                right_PWM = mixer_output.right_pwm; left_PWM = mixer_output.left_pwm;
             }
         }
 
 // If Y-switch pressed then set half speed
-        if (temp_gamepad_data.button_Y == true) {
+        if ((temp_gamepad_data.button_Y == true) && (arc == false)) {
             left_PWM  = (left_PWM < 0)  ? -GAMEPAD_MODE_0_FAST_SPEED : +GAMEPAD_MODE_0_FAST_SPEED;
             right_PWM = (right_PWM < 0) ? -GAMEPAD_MODE_0_FAST_SPEED : +GAMEPAD_MODE_0_FAST_SPEED;
         }
 
 
 // send right motor command
-        motor_cmd_packet.cmd = right_cmd;
-        motor_cmd_packet.param1  = RIGHT_MOTOR;
-        motor_cmd_packet.param2  = right_PWM;
-        xQueueSend(queue_motor_cmds, &motor_cmd_packet, portMAX_DELAY);
+        send_motor_cmd(right_cmd, RIGHT_MOTOR, right_PWM, MOTOR_CMD_DEFAULT_DEADLINE_MS);
 
 // send left motor command ( See note at function header)
-        motor_cmd_packet.cmd = left_cmd;
-        motor_cmd_packet.param1  = LEFT_MOTOR;
-        motor_cmd_packet.param2  = left_PWM;
-        xQueueSend(queue_motor_cmds, &motor_cmd_packet, portMAX_DELAY);
+        send_motor_cmd(left_cmd, LEFT_MOTOR, left_PWM, MOTOR_CMD_DEFAULT_DEADLINE_MS);
 
         vTaskDelay(100/portTICK_PERIOD_MS);   // approx 10Hz reading of gamepad
     }
@@ -0,0 +1,159 @@
+/**
+ * @file run_lab_modes.c
+ * @author Jim Herd
+ * @brief Implement Lab mode : live plots of sensor data
+ */
+
+// Notes
+//      Each Lab mode plots a set of CD4051 channels as a strip chart in
+//      the lower half of the display, with a widget screen of current
+//      values on the message row.  Samples are taken at the sensor task rate.
+//
+//      Active switches are 
+//          switch D = exit mode
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "system.h"
+#include "common.h"
+#include "SSD1306.h"
+#include "Robokid_strings.h"
+#include "run_lab_modes.h"
+#include "strip_chart.h"
+#include "widgets.h"
+#include "menus.h"
+
+#include "FreeRTOS.h"
+#include "event_groups.h"
+
+//==============================================================================
+
+enum l_modes {L_LINE_SENSORS, L_BATTERY, L_POTS};
+
+struct menu lab_mode_menu = {
+    false,
+    3,
+    {
+        " Line sensors ",
+        " Battery      ",
+        " POTs         ",
+    },
+    {   
+        execute_lab_chart, 
+        execute_lab_chart,
+        execute_lab_chart,
+    }
+};
+
+// Widget screens of current values on the message row
+
+#define     LAB_VALUES_TOP      ((MESSAGE_ROW - 1) * 16)
+#define     LAB_MAX_WIDGETS     3
+
+static const struct widget_s line_sensor_widgets[] = {
+    {WIDGET_VALUE,  0, LAB_VALUES_TOP, 0, 4, 0, false, "L%3d"},
+    {WIDGET_VALUE, 45, LAB_VALUES_TOP, 0, 4, 0, false, "M%3d"},
+    {WIDGET_VALUE, 90, LAB_VALUES_TOP, 0, 4, 0, false, "R%3d"},
+};
+
+static const struct widget_s battery_widgets[] = {
+    {WIDGET_LABEL,  0, LAB_VALUES_TOP,     0,  4,  0, false, "Batt"},
+    {WIDGET_VALUE, 36, LAB_VALUES_TOP,     0,  4,  0, false, "%3d%%"},
+    {WIDGET_BAR,   76, LAB_VALUES_TOP + 2, 0, 50, 12, false, NULL, 0, 100},
+};
+
+static const struct widget_s pot_widgets[] = {
+    {WIDGET_VALUE,  0, LAB_VALUES_TOP, 0, 4, 0, false, "A%3d"},
+    {WIDGET_VALUE, 45, LAB_VALUES_TOP, 0, 4, 0, false, "B%3d"},
+    {WIDGET_VALUE, 90, LAB_VALUES_TOP, 0, 4, 0, false, "C%3d"},
+};
+
+static struct widget_state_s    lab_widget_state[LAB_MAX_WIDGETS];
+
+static struct widget_screen_s   line_sensor_screen = {LAB_VALUES_TOP, 16, NOS_WIDGETS(line_sensor_widgets), line_sensor_widgets, lab_widget_state};
+static struct widget_screen_s   battery_screen     = {LAB_VALUES_TOP, 16, NOS_WIDGETS(battery_widgets),     battery_widgets,     lab_widget_state};
+static struct widget_screen_s   pot_screen         = {LAB_VALUES_TOP, 16, NOS_WIDGETS(pot_widgets),         pot_widgets,         lab_widget_state};
+
+// Channels plotted by each mode (top lane first), value screen and the
+// entry of the sample values shown by each widget
+
+static const struct {
+    uint8_t                 nos_channels;
+    uint8_t                 channel[STRIP_CHART_MAX_CHANNELS];
+    struct widget_screen_s  *screen;
+    uint8_t                 value_index[LAB_MAX_WIDGETS];
+} lab_chart_config[] = {
+    {3, {LINE_SENSOR_LEFT_CHANNEL, LINE_SENSOR_MID_CHANNEL, LINE_SENSOR_RIGHT_CHANNEL}, &line_sensor_screen, {0, 1, 2}},
+    {1, {MOTOR_VOLTAGE_CHANNEL},                                                        &battery_screen,     {0, 0, 0}},
+    {3, {POT_A_channel, POT_B_channel, POT_C_channel},                                  &pot_screen,         {0, 1, 2}},
+};
+
+static struct strip_chart_s     lab_chart;
+
+//==============================================================================
+
+error_codes_te run_lab_modes(uint8_t mode_index, uint32_t parameter) 
+{
+    return run_menu(&lab_mode_menu);
+}
+
+/**
+ * @brief Plot selected channels until switch D is pressed
+ * 
+ * @param mode_index    index into lab_chart_config
+ * @param parameter 
+ * @return error_codes_te 
+ */
+error_codes_te execute_lab_chart(uint8_t mode_index, uint32_t  parameter)
+{
+uint8_t                 values[STRIP_CHART_MAX_CHANNELS];
+struct widget_screen_s  *screen;
+TickType_t              xLastWakeTime;
+
+#ifdef DISPLAY_ON_CORE1
+    LCD_write_row(0, MESSAGE_ROW, " Not on core1 ", true);
+    wait_for_button_press(PUSH_BUTTON_D, portMAX_DELAY);
+    return OK;
+#endif
+
+// stop scroller and let display task finish any pending row updates
+
+    DISABLE_SCROLLER;
+    vTaskDelay(2 * TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT);
+    LCD_set_refresh_class(LCD_CLASS_LIVE);
+
+    strip_chart_init(&lab_chart, lab_chart_config[mode_index].nos_channels, STRIP_CHART_DECIMATION);
+    memset(values, 0, sizeof(values));
+    screen = lab_chart_config[mode_index].screen;
+    for (uint8_t index = 0; index < screen->nos_widgets; index++) {
+        widget_set_value(screen, index, 0);
+    }
+    widget_screen_show(screen);
+    xLastWakeTime = xTaskGetTickCount();
+    FOREVER {
+        xTaskDelayUntil(&xLastWakeTime, TASK_READ_SENSORS_FREQUENCY_TICK_COUNT);
+        if ((xEventGroupGetBits(eventgroup_push_buttons) & PUSH_BUTTON_D_EVENT_MASK) != 0) {
+            break;
+        }
+        xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+            for (uint8_t index = 0; index < lab_chart_config[mode_index].nos_channels; index++) {
+                values[index] = system_IO_data.analogue_global_data[lab_chart_config[mode_index].channel[index]].raw.percent_current_value;
+            }
+        xSemaphoreGive(semaphore_system_IO_data);
+
+        if (strip_chart_add_sample(&lab_chart, values) == true) {
+            for (uint8_t index = 0; index < screen->nos_widgets; index++) {
+                widget_set_value(screen, index, values[lab_chart_config[mode_index].value_index[index]]);
+            }
+            widget_screen_update(screen);
+        }
+    }
+    WAIT_BUTTON_RELEASED(PUSH_BUTTON_D);
+
+// restore text rows over plot area
+
+    LCD_set_refresh_class(LCD_CLASS_MENU);
+    LCD_refresh_all_rows();
+    return OK;
+}
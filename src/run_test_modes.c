@@ -9,14 +9,28 @@
 //      Mostly, they exercise some aspect of the system and dump data to the
 //      rp2040 uart channel for collection by a PC.  Where possible, this
 //      data will be in a comma delimited ASCI format to allow it to be
-//      imported into excel for display.
+//      imported into excel for display.  Tests 1 and 2 stream binary
+//      telemetry frames at the sensor rate instead : these are converted
+//      to CSV by tools/telemetry_decoder.py.
 //
 //      Tests
 //          0. Print version and cycle LEDs
-//          1. Read raw data from CD4051 8-channel analogue inputs
-//          2. Log data from a single CD4051 channel
+//          1. Stream CD4051 analogue, motor and task telemetry (binary)
+//          2. Stream data from a single CD4051 channel (binary)
 //          3. Print relevant task data
-//          4. ........
+//          4. Log odometry estimate
+//          5. Print motor command latency histogram
+//          6. Check motor watchdog reaction time (wheels will turn briefly)
+//          7. Check emergency stop latency (wheels will turn briefly)
+//          8. Display flush benchmark
+//          9. Font render benchmark
+//         10. Display bus load in steady state
+//         11. Multi-font text screens (8 line debug, large readout)
+//         12. Graphics primitive benchmark
+//         13. Capture display bus traffic for host emulator
+//         14. Sprite animation
+//         15. Display write transaction benchmark
+//         16. ........
 
 #include <stdlib.h>
 #include <string.h>
@@ -24,9 +38,16 @@
 #include "system.h"
 #include "menus.h"
 #include "common.h"
+#include "OLED_128X64.h"
 #include "SSD1306.h"
 #include "Robokid_strings.h"
 #include "run_test_modes.h"
+#include "odometry.h"
+#include "DRV8833_pwm.h"
+#include "sprites.h"
+#include "telemetry.h"
+
+#include "hardware/clocks.h"
 
 #include "FreeRTOS.h"
 
@@ -35,7 +56,6 @@
 //==============================================================================
 
 char    temp_string[128];
-static struct  analogue_global_data_s      temp_analogue_global_data[NOS_CD4051_CHANNELS];
 
 //==============================================================================
 // Main routine
@@ -88,31 +108,34 @@ error_codes_te run_test_0(uint8_t mode_index, uint32_t parameter)
 }
 
 /**
- * @brief Read raw data from CD4051 8-channel analogue inputs
+ * @brief Stream CD4051 8-channel analogue inputs, motor state and task data
+ * 
+ * Analogue and motor records are sent at the sensor task rate, task
+ * records every TELEMETRY_TASK_STATS_MS.  Press button D to stop.
  * 
  * @param parameter 
  * @return error_codes_te 
  */
  error_codes_te run_test_1(uint8_t mode_index, uint32_t parameter)
 {
-    print_string("POT A,POT B,Spare,Vm,IR Left,IR Mid,IR Right, POT C\n");
-    for (uint32_t index = 0; index < 100; index++) {
-        xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
-           memcpy(&temp_analogue_global_data, &system_IO_data.analogue_global_data, (NOS_CD4051_CHANNELS * sizeof(struct analogue_global_data_s)));
-        xSemaphoreGive(semaphore_system_IO_data);
-        sprintf(temp_string, "%u,%u,%u,%u,%u,%u,%u,%u\n", 
-            temp_analogue_global_data[0].processed.value,
-            temp_analogue_global_data[1].processed.value,
-            temp_analogue_global_data[2].processed.value,
-            temp_analogue_global_data[3].processed.value,
-            temp_analogue_global_data[4].processed.value,
-            temp_analogue_global_data[5].processed.value,
-            temp_analogue_global_data[6].processed.value,
-            temp_analogue_global_data[7].processed.value
-        );
-        print_string(temp_string);
-        vTaskDelay(TWO_SECONDS);
+TickType_t      xLastWakeTime;
+uint32_t        count;
+
+    count = 0;
+    xLastWakeTime = xTaskGetTickCount();
+    FOREVER {
+        xTaskDelayUntil(&xLastWakeTime, TASK_READ_SENSORS_FREQUENCY_TICK_COUNT);
+        if ((xEventGroupGetBits(eventgroup_push_buttons) & PUSH_BUTTON_D_EVENT_MASK) != 0) {
+            break;
+        }
+        telemetry_send_analogue();
+        telemetry_send_motor();
+        if (++count == (TELEMETRY_TASK_STATS_MS / (1000 / TASK_READ_SENSORS_FREQUENCY))) {
+            telemetry_send_tasks();
+            count = 0;
+        }
     }
+    WAIT_BUTTON_RELEASED(PUSH_BUTTON_D);
     return OK;
 }
 
@@ -129,31 +152,26 @@ error_codes_te run_test_0(uint8_t mode_index, uint32_t parameter)
 }
 
 /**
- * @brief output data from selected CD4051 channel
+ * @brief Stream data from selected CD4051 channel
+ * 
+ * Records are sent at the sensor task rate.  Press button D to stop.
  * 
  * @param parameter 
  * @return error_codes_te 
  */
  error_codes_te run_test_2(uint8_t mode_index, uint32_t parameter)
 {
-    sprintf(temp_string, "Channel %u\n", mode_index);
-    print_string(temp_string);
-    sprintf(temp_string,"Raw,Filter,G_thresh,G_count,Max_delta\n");
-    print_string(temp_string);
-    for (uint32_t index = 0; index < 100; index++) {
-        xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
-            memcpy(&temp_analogue_global_data, &system_IO_data.analogue_global_data, (NOS_CD4051_CHANNELS * sizeof(struct analogue_global_data_s)));
-        xSemaphoreGive(semaphore_system_IO_data);
-        sprintf(temp_string, "%u,%u,%u,%u,%u\n", 
-                temp_analogue_global_data[mode_index].raw.current_value,
-                temp_analogue_global_data[mode_index].processed.value,
-                temp_analogue_global_data[mode_index].raw.glitch_threshold,
-                temp_analogue_global_data[mode_index].raw.glitch_count,
-                temp_analogue_global_data[mode_index].raw.max_delta
-        );
-        print_string(temp_string);
-        vTaskDelay(ONE_SECOND);
+TickType_t      xLastWakeTime;
+
+    xLastWakeTime = xTaskGetTickCount();
+    FOREVER {
+        xTaskDelayUntil(&xLastWakeTime, TASK_READ_SENSORS_FREQUENCY_TICK_COUNT);
+        if ((xEventGroupGetBits(eventgroup_push_buttons) & PUSH_BUTTON_D_EVENT_MASK) != 0) {
+            break;
+        }
+        telemetry_send_analogue_channel(mode_index);
     }
+    WAIT_BUTTON_RELEASED(PUSH_BUTTON_D);
     return OK;
 }
 
@@ -180,13 +198,835 @@ error_codes_te run_test_3(uint8_t mode_index, uint32_t parameter)
     return OK;
 }
 
+/**
+ * @brief Log odometry estimate
+ * 
+ * Prints the odometry pose at the sensor task rate.  Wheel speeds and
+ * pose can be compared in a spreadsheet against the ideal differential
+ * drive kinematics, or against measured robot position.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
 error_codes_te run_test_4(uint8_t mode_index, uint32_t parameter)
 {
+struct odometry_data_s  temp_odometry_data;
+
+    odometry_reset();
+    print_string("Count,Left mm/S,Right mm/S,X mm,Y mm,Heading,Distance mm\n");
+    for (uint32_t index = 0; index < 500; index++) {
+        xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+            memcpy(&temp_odometry_data, &system_IO_data.odometry_data, sizeof(struct odometry_data_s));
+        xSemaphoreGive(semaphore_system_IO_data);
+        sprintf(temp_string, "%u,%d,%d,%d,%d,%d,%u\n",
+            temp_odometry_data.update_count,
+            temp_odometry_data.left_speed_mm_s,
+            temp_odometry_data.right_speed_mm_s,
+            temp_odometry_data.x_mm,
+            temp_odometry_data.y_mm,
+            temp_odometry_data.heading_degrees,
+            temp_odometry_data.distance_mm
+        );
+        print_string(temp_string);
+        vTaskDelay(TASK_READ_SENSORS_FREQUENCY_TICK_COUNT * 5);
+    }
     return OK;
 }
 
+/**
+ * @brief Print motor command queue latency histogram
+ * 
+ * One line per histogram bin : upper limit of bin (uS) and count.
+ * Last bin counts all commands above the previous limit.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
 error_codes_te run_test_5(uint8_t mode_index, uint32_t parameter)
 {
+struct motor_cmd_stats_s    temp_motor_cmd_stats;
+uint32_t                    limit;
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        memcpy(&temp_motor_cmd_stats, &system_IO_data.motor_cmd_stats, sizeof(struct motor_cmd_stats_s));
+    xSemaphoreGive(semaphore_system_IO_data);
+
+    sprintf(temp_string, "Received,%u\nExpired,%u\nMax latency uS,%u\n",
+        temp_motor_cmd_stats.commands_received,
+        temp_motor_cmd_stats.commands_expired,
+        temp_motor_cmd_stats.max_latency_us
+    );
+    print_string(temp_string);
+    print_string("Latency < uS,Count\n");
+    limit = MOTOR_CMD_LATENCY_BIN_0_US;
+    for (uint8_t bin = 0; bin < MOTOR_CMD_LATENCY_BINS; bin++) {
+        if (bin == (MOTOR_CMD_LATENCY_BINS - 1)) {
+            sprintf(temp_string, "max,%u\n", temp_motor_cmd_stats.latency_histogram[bin]);
+        } else {
+            sprintf(temp_string, "%u,%u\n", limit, temp_motor_cmd_stats.latency_histogram[bin]);
+        }
+        print_string(temp_string);
+        limit <<= 1;
+    }
+    return OK;
+}
+
+/**
+ * @brief Check motor watchdog reaction time
+ * 
+ * Start both motors, then stop sending commands.  The watchdog should
+ * brake the motors within MOTOR_WATCHDOG_TIMEOUT_MS + MOTOR_WATCHDOG_CHECK_MS.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+error_codes_te run_test_6(uint8_t mode_index, uint32_t parameter)
+{
+struct motor_watchdog_data_s    before, after;
+uint32_t                        limit_us;
+bool                            pass;
+
+    motor_watchdog_get_data(&before);
+    send_motor_cmd(MOVE, LEFT_MOTOR, 30, MOTOR_CMD_NO_DEADLINE);
+    send_motor_cmd(MOVE, RIGHT_MOTOR, 30, MOTOR_CMD_NO_DEADLINE);
+    vTaskDelay((2 * MOTOR_WATCHDOG_TIMEOUT_MS)/portTICK_PERIOD_MS);
+    motor_watchdog_get_data(&after);
+
+    limit_us = (MOTOR_WATCHDOG_TIMEOUT_MS + MOTOR_WATCHDOG_CHECK_MS) * 1000;
+    pass = ((after.trip_count == (before.trip_count + 1)) && (after.last_reaction_us <= limit_us));
+
+    sprintf(temp_string, "Trips,%u\nReaction uS,%u\nMax reaction uS,%u\nLimit uS,%u\n%s\n",
+        after.trip_count,
+        after.last_reaction_us,
+        after.max_reaction_us,
+        limit_us,
+        (pass == true) ? "PASS" : "FAIL"
+    );
+    print_string(temp_string);
+    return OK;
+}
+
+/**
+ * @brief Check emergency stop latency
+ * 
+ * Start both motors forward, then queue reverse MOVE commands so that
+ * the motor task is in its zero cross over delay, and request an
+ * emergency stop. Neither the move in progress nor queued moves may
+ * restart the motors. Latency is from the request to the brake write.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+error_codes_te run_test_7(uint8_t mode_index, uint32_t parameter)
+{
+struct emergency_stop_data_s    stop_data;
+int8_t                          left_pwm, right_pwm;
+
+    send_motor_cmd(MOVE, LEFT_MOTOR, 30, MOTOR_CMD_NO_DEADLINE);
+    send_motor_cmd(MOVE, RIGHT_MOTOR, 30, MOTOR_CMD_NO_DEADLINE);
+    vTaskDelay(100/portTICK_PERIOD_MS);
+    for (uint8_t index = 0; index < (MOTOR_CMD_QUEUE_LENGTH / 2); index++) {
+        send_motor_cmd(MOVE, LEFT_MOTOR, -40, MOTOR_CMD_NO_DEADLINE);
+        send_motor_cmd(MOVE, RIGHT_MOTOR, -40, MOTOR_CMD_NO_DEADLINE);
+    }
+    emergency_stop(time_us_32());
+    vTaskDelay(100/portTICK_PERIOD_MS);
+
+    emergency_stop_get_data(&stop_data);
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        left_pwm  = system_IO_data.motor_data[LEFT_MOTOR].pwm_width;
+        right_pwm = system_IO_data.motor_data[RIGHT_MOTOR].pwm_width;
+    xSemaphoreGive(semaphore_system_IO_data);
+
+    sprintf(temp_string, "Stops,%u\nLatency uS,%u\nMax latency uS,%u\nLeft PWM,%d\nRight PWM,%d\n%s\n",
+        stop_data.stop_count,
+        stop_data.last_latency_us,
+        stop_data.max_latency_us,
+        left_pwm,
+        right_pwm,
+        ((left_pwm == 0) && (right_pwm == 0)) ? "PASS" : "FAIL"
+    );
+    print_string(temp_string);
+    return OK;
+}
+
+/**
+ * @brief Display flush benchmark
+ * 
+ * Render typical display updates into the display RAM copy, flush, and
+ * print the bus traffic of each.  Ends with the I2C bus rate achieved
+ * and the refresh budget at that rate.  Page mode is the cost of the previous
+ * method : 3 single byte commands plus one 128 byte data transaction for
+ * each page of each row written.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+#define     PAGE_MODE_BYTES_PER_PAGE    ((3 * 2) + (SSD1306_LCDWIDTH + 1))
+
+// address window (control + 6 command bytes) then control + data, plus an I2C address byte for each
+#define     FULL_SCREEN_BUS_BYTES       ((1 + 6) + (1 + SSD1306_RAM_SIZE) + 2)
+#define     PAGE_BUS_BYTES              ((1 + 6) + (1 + SSD1306_LCDWIDTH) + 2)
+
+static void print_flush_result(const char *name, struct SSD1306_stats_s *before, uint32_t nos_pages)
+{
+    sprintf(temp_string, "%s,%u,%u,%u,%u\n",
+        name,
+        SSD1306_stats.bytes_sent - before->bytes_sent,
+        SSD1306_stats.transactions - before->transactions,
+        SSD1306_stats.last_flush_us,
+        nos_pages * PAGE_MODE_BYTES_PER_PAGE
+    );
+    print_string(temp_string);
+}
+
+error_codes_te run_test_8(uint8_t mode_index, uint32_t parameter)
+{
+struct SSD1306_stats_s      before;
+uint8_t                     icon_string[2] = {BATTERY_FULL, '\0'};
+uint8_t                     error = OK;
+
+#ifdef DISPLAY_ON_CORE1
+    print_string("Not available : display owned by core 1\n");
+    return OK;
+#endif
+    print_string("Update,Bytes,Transactions,Flush uS,Page mode bytes\n");
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        SSD1306_flush();        // start clean
+
+    // menu update : message row and both scroll rows
+
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        error |= SSD1306_write_string(0, MESSAGE_ROW, (const uint8_t *)"  Benchmark   ", false);
+        error |= SSD1306_write_string(0, SCROLL_ROW_UPPER, (const uint8_t *)" Menu entry 1 ", true);
+        error |= SSD1306_write_string(0, SCROLL_ROW_LOWER, (const uint8_t *)" Menu entry 2 ", false);
+        SSD1306_flush();
+        print_flush_result("Menu", &before, 6);
+
+    // single icon glyph
+
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        error |= SSD1306_write_string(1, ICON_ROW, icon_string, false);
+        SSD1306_flush();
+        print_flush_result("Icon", &before, 2);
+
+    // full screen
+
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        SSD1306_set_window(0, 0x00);
+        SSD1306_flush();
+        print_flush_result("Full screen", &before, SSD1306_NOS_PAGES);
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+// force display task to restore all rows
+
+    LCD_refresh_all_rows();
+
+    sprintf(temp_string, "Flushes,%u\nMax flush uS,%u\n", SSD1306_stats.flush_count, SSD1306_stats.max_flush_us);
+    print_string(temp_string);
+
+// bus rate and refresh budget : time on the bus for a full screen and for one page
+
+    sprintf(temp_string, "I2C bits/S,%u\nSpeed fallbacks,%u\nFull screen bus uS,%u\nMax full screens/S,%u\nPage bus uS,%u\n",
+        SSD1306_stats.i2c_baudrate,
+        SSD1306_stats.speed_fallbacks,
+        SSD1306_bus_time_us(FULL_SCREEN_BUS_BYTES),
+        (SSD1306_stats.i2c_baudrate == 0) ? 0 : (1000000 / SSD1306_bus_time_us(FULL_SCREEN_BUS_BYTES)),
+        SSD1306_bus_time_us(PAGE_BUS_BYTES)
+    );
+    print_string(temp_string);
+    return (error == OK) ? OK : FAULT;
+}
+
+/**
+ * @brief Font render benchmark
+ * 
+ * Time the rendering of a full text row into the display RAM copy.
+ * "Column major" is the previous method : strided reads of the original
+ * GLCD font data.  "Page major" is SSD1306_write_string() using the
+ * generated page-major fonts (and glyph cache, if enabled).
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+#define     RENDER_BENCHMARK_ROWS   100
+
+static const uint8_t    render_test_row[] = "Robokid 0123~!";
+
+static void render_row_column_major(const uint8_t *font, uint8_t first_page, const uint8_t *buffer)
+{
+uint8_t         pixel_width, nos_pages, first_char, last_char, character;
+uint8_t         *ram_pt;
+const uint8_t   *font_index;
+uint32_t        column;
+
+    pixel_width = font[0];
+    nos_pages   = font[1] / 8;
+    first_char  = font[2];
+    last_char   = font[3];
+    for (uint8_t i=0 ; i < nos_pages ; i++) {
+        column = 0;
+        ram_pt = &SSD1306_RAM[(first_page + i) * SSD1306_LCDWIDTH];
+        for (uint8_t j=0 ; buffer[j] != '\0' ; j++) {
+            character = buffer[j];
+            if ((character < first_char) || (character > last_char)) {
+                character = first_char;
+            }
+            font_index = font + 4 + ((character - first_char) * (pixel_width * nos_pages));
+            for (uint8_t k=i; k < (pixel_width * nos_pages); k=k+nos_pages) {
+                if (column >= SSD1306_LCDWIDTH) {
+                    break;
+                }
+                *ram_pt++ = font_index[k];
+                column++;
+            }
+        }
+        SSD1306_mark_dirty((first_page + i), 0, (column - 1));
+    }
+}
+
+static void print_render_result(const char *name, uint32_t time_us)
+{
+uint32_t    cycles_per_us;
+
+    cycles_per_us = clock_get_hz(clk_sys) / 1000000;
+    sprintf(temp_string, "%s,%u,%u\n",
+        name,
+        time_us / RENDER_BENCHMARK_ROWS,
+        (time_us * cycles_per_us) / RENDER_BENCHMARK_ROWS
+    );
+    print_string(temp_string);
+}
+
+error_codes_te run_test_9(uint8_t mode_index, uint32_t parameter)
+{
+uint32_t    start_time, column_major_us, page_major_us;
+uint8_t     error = OK;
+
+#ifdef DISPLAY_ON_CORE1
+    print_string("Not available : display owned by core 1\n");
+    return OK;
+#endif
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        vTaskSuspendAll();
+            start_time = time_us_32();
+            for (uint32_t count = 0; count < RENDER_BENCHMARK_ROWS; count++) {
+                render_row_column_major(Terminal_9x16, 2, render_test_row);
+            }
+            column_major_us = time_us_32() - start_time;
+
+            start_time = time_us_32();
+            for (uint32_t count = 0; count < RENDER_BENCHMARK_ROWS; count++) {
+                error |= SSD1306_write_string(0, MESSAGE_ROW, render_test_row, false);
+            }
+            page_major_us = time_us_32() - start_time;
+        xTaskResumeAll();
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+// force display task to restore all rows
+
+    LCD_refresh_all_rows();
+
+    print_string("Render,uS per row,Cycles per row\n");
+    print_render_result("Column major", column_major_us);
+    print_render_result("Page major", page_major_us);
+    sprintf(temp_string, "Glyph cache entries,%u\nCache hits,%u\nCache misses,%u\n",
+        SSD1306_GLYPH_CACHE_ENTRIES,
+        SSD1306_stats.glyph_cache_hits,
+        SSD1306_stats.glyph_cache_misses
+    );
+    print_string(temp_string);
+    return (error == OK) ? OK : FAULT;
+}
+
+/**
+ * @brief Display bus load in steady state
+ * 
+ * Count display bus traffic over a fixed period while the display task
+ * runs normally (icons, message row, scrolling menu).
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+#define     BUS_LOAD_MEASURE_MS     5000
+
+error_codes_te run_test_10(uint8_t mode_index, uint32_t parameter)
+{
+struct SSD1306_stats_s      before, after;
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+    vTaskDelay(BUS_LOAD_MEASURE_MS/portTICK_PERIOD_MS);
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        memcpy(&after, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+    sprintf(temp_string, "Bytes/S,%u\nTransactions/S,%u\nFlushes/S,%u\nIcon row builds,%u\nIcon rows suppressed,%u\nScroll steps,%u\n",
+        ((after.bytes_sent - before.bytes_sent) * 1000) / BUS_LOAD_MEASURE_MS,
+        ((after.transactions - before.transactions) * 1000) / BUS_LOAD_MEASURE_MS,
+        ((after.flush_count - before.flush_count) * 1000) / BUS_LOAD_MEASURE_MS,
+        after.icon_row_builds - before.icon_row_builds,
+        after.icon_rows_suppressed - before.icon_rows_suppressed,
+        after.scroll_steps - before.scroll_steps
+    );
+    print_string(temp_string);
+    sprintf(temp_string, "Update cost uS,%u\nUpdate interval mS,%u\nDisplay busy %%,%u\n",
+        after.frame_cost_us,
+        after.update_interval_ms,
+        (after.frame_time_us - before.frame_time_us) / (BUS_LOAD_MEASURE_MS * 10)
+    );
+    print_string(temp_string);
+    return OK;
+}
+
+/**
+ * @brief Multi-font text screens
+ * 
+ * Display live odometry as a dense 8 line debug screen (6x8 font), then
+ * as a large speed readout (25x40 font) with a label at a non page
+ * aligned position.  Each frame is redrawn in full at the display task
+ * rate.  Prints average render and flush time per frame.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+#define     FONT_DEMO_FRAMES    50
+
+static void print_frame_result(const char *name, uint32_t render_us, uint32_t flush_us, uint32_t bytes)
+{
+    sprintf(temp_string, "%s,%u,%u,%u\n",
+        name,
+        render_us / FONT_DEMO_FRAMES,
+        flush_us / FONT_DEMO_FRAMES,
+        bytes / FONT_DEMO_FRAMES
+    );
+    print_string(temp_string);
+}
+
+error_codes_te run_test_11(uint8_t mode_index, uint32_t parameter)
+{
+struct odometry_data_s  odometry;
+char                    line[LCD_ROW_STRING_LENGTH];
+uint32_t                start_time, render_us, flush_us, bytes;
+TickType_t              xLastWakeTime;
+
+#ifdef DISPLAY_ON_CORE1
+    print_string("Not available : display owned by core 1\n");
+    return OK;
+#endif
+    print_string("Screen,Render uS,Flush uS,Bytes\n");
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+
+// debug screen : 8 lines of 21 characters
+
+        render_us = 0; flush_us = 0; bytes = SSD1306_stats.bytes_sent;
+        xLastWakeTime = xTaskGetTickCount();
+        for (uint32_t frame = 0; frame < FONT_DEMO_FRAMES; frame++) {
+            xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+                memcpy(&odometry, &system_IO_data.odometry_data, sizeof(struct odometry_data_s));
+            xSemaphoreGive(semaphore_system_IO_data);
+            start_time = time_us_32();
+            for (uint8_t row = 0; row < 8; row++) {
+                switch (row) {
+                    case 0 : sprintf(line, "Frame %-15u", frame); break;
+                    case 1 : sprintf(line, "X mm %-16d", odometry.x_mm); break;
+                    case 2 : sprintf(line, "Y mm %-16d", odometry.y_mm); break;
+                    case 3 : sprintf(line, "Heading %-13d", odometry.heading_degrees); break;
+                    case 4 : sprintf(line, "Left mm/S %-11d", odometry.left_speed_mm_s); break;
+                    case 5 : sprintf(line, "Right mm/S %-10d", odometry.right_speed_mm_s); break;
+                    case 6 : sprintf(line, "Distance %-12u", odometry.distance_mm); break;
+                    default: sprintf(line, "Updates %-13u", odometry.update_count); break;
+                }
+                SSD1306_draw_text(FONT_6x8, 0, (row * FONT_6x8_HEIGHT), (const uint8_t *)line, strlen(line), false);
+            }
+            render_us += time_us_32() - start_time;
+            start_time = time_us_32();
+            SSD1306_flush();
+            flush_us += time_us_32() - start_time;
+            xTaskDelayUntil(&xLastWakeTime, TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT);
+        }
+        print_frame_result("Debug 6x8", render_us, flush_us, (SSD1306_stats.bytes_sent - bytes));
+
+// large readout : label at y = 3, then speed in 25x40 font
+
+        SSD1306_set_window(0, 0x00);
+        render_us = 0; flush_us = 0; bytes = SSD1306_stats.bytes_sent;
+        for (uint32_t frame = 0; frame < FONT_DEMO_FRAMES; frame++) {
+            xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+                memcpy(&odometry, &system_IO_data.odometry_data, sizeof(struct odometry_data_s));
+            xSemaphoreGive(semaphore_system_IO_data);
+            start_time = time_us_32();
+            SSD1306_draw_text(FONT_TERMINAL_12x16, 4, 3, (const uint8_t *)"Speed mm/S", 10, false);
+            sprintf(line, "%04u", abs(odometry.speed_mm_s) % 10000);
+            SSD1306_draw_text(FONT_SEGMENT_25x40, 14, (SSD1306_LCDHEIGHT - SEGMENT_25x40_FONT_HEIGHT), (const uint8_t *)line, 4, false);
+            render_us += time_us_32() - start_time;
+            start_time = time_us_32();
+            SSD1306_flush();
+            flush_us += time_us_32() - start_time;
+            xTaskDelayUntil(&xLastWakeTime, TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT);
+        }
+        print_frame_result("Readout 25x40", render_us, flush_us, (SSD1306_stats.bytes_sent - bytes));
+
+        SSD1306_set_window(0, 0x00);
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+    LCD_refresh_all_rows();
+    return OK;
+}
+
+/**
+ * @brief Graphics primitive benchmark
+ * 
+ * Draw each primitive into the display RAM copy, then flush once.  Prints
+ * pixels drawn, render and flush time, and bus traffic.  The last column
+ * is the cost of the previous per-pixel method : 3 command transactions
+ * plus 1 data transaction (8 bytes) for each pixel.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+#define     PIXEL_MODE_TRANSACTIONS_PER_PIXEL   4
+
+enum primitive_e {P_LINE, P_RECTANGLE, P_FILL_RECTANGLE, P_CIRCLE, P_FILL_CIRCLE, P_BITMAP, NOS_PRIMITIVES};
+
+static const char *primitive_names[NOS_PRIMITIVES] = {
+    "Line", "Rectangle", "Fill rectangle", "Circle", "Fill circle", "Bitmap 32x32",
+};
+
+error_codes_te run_test_12(uint8_t mode_index, uint32_t parameter)
+{
+struct SSD1306_stats_s      before;
+static uint8_t              pattern[32 * 4];
+uint32_t                    start_time, render_us, flush_us, pixels;
+
+#ifdef DISPLAY_ON_CORE1
+    print_string("Not available : display owned by core 1\n");
+    return OK;
+#endif
+    for (uint32_t i = 0; i < sizeof(pattern); i++) {
+        pattern[i] = (i & 1) ? 0xAA : 0x55;         // checkerboard
+    }
+    print_string("Primitive,Pixels,Render uS,Flush uS,Transactions,Bytes,Pixel mode transactions\n");
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        for (uint32_t primitive = 0; primitive < NOS_PRIMITIVES; primitive++) {
+            SSD1306_set_window(0, 0x00);
+            SSD1306_flush();
+            memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+            pixels = Oled_GetPlotCount();
+            start_time = time_us_32();
+            switch (primitive) {
+                case P_LINE           : Oled_Line(0, 0, 127, 63, BLACK); break;
+                case P_RECTANGLE      : Oled_Rectangle(10, 5, 117, 58, BLACK); break;
+                case P_FILL_RECTANGLE : Oled_FillRectangle(10, 5, 117, 58, BLACK); break;
+                case P_CIRCLE         : Oled_Circle(63, 31, 30, BLACK); break;
+                case P_FILL_CIRCLE    : Oled_FillCircle(63, 31, 20, BLACK); break;
+                default               : Oled_Bitmap(pattern, 48, 13, 32, 32); break;
+            }
+            render_us = time_us_32() - start_time;
+            pixels = Oled_GetPlotCount() - pixels;
+            start_time = time_us_32();
+            SSD1306_flush();
+            flush_us = time_us_32() - start_time;
+            sprintf(temp_string, "%s,%u,%u,%u,%u,%u,%u\n",
+                primitive_names[primitive],
+                pixels,
+                render_us,
+                flush_us,
+                SSD1306_stats.transactions - before.transactions,
+                SSD1306_stats.bytes_sent - before.bytes_sent,
+                pixels * PIXEL_MODE_TRANSACTIONS_PER_PIXEL
+            );
+            print_string(temp_string);
+        }
+        SSD1306_set_window(0, 0x00);
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+    LCD_refresh_all_rows();
+    return OK;
+}
+
+/**
+ * @brief Capture display bus traffic for host emulator
+ * 
+ * Each frame is a display update done through the normal driver code.
+ * The I2C transactions of each frame are printed as :
+ * 
+ *      F,<frame name>
+ *      T,<control byte>,<length>       one per transaction
+ *      D,<up to 32 bytes in hex>       transaction data
+ * 
+ * Save the output and decode with tools/ssd1306_emulator.py to get an
+ * image of the display after each frame, and the bus traffic of each.
+ * The first frame sends the initialisation sequence and the whole
+ * display so that the emulator starts in a known state.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+#define     CAPTURE_BUFFER_SIZE         2048
+#define     CAPTURE_BYTES_PER_LINE      32
+
+static uint8_t  capture_buffer[CAPTURE_BUFFER_SIZE];
+
+static void print_capture(const char *name, uint32_t nos_bytes, bool overflow)
+{
+uint32_t    index, len, chunk;
+char        *pt;
+
+    sprintf(temp_string, "F,%s\n", name);
+    print_string(temp_string);
+    if (overflow == true) {
+        print_string("X,capture buffer overflow\n");
+    }
+    index = 0;
+    while ((index + 3) <= nos_bytes) {
+        len = capture_buffer[index + 1] | (capture_buffer[index + 2] << 8);
+        sprintf(temp_string, "T,%02X,%u\n", capture_buffer[index], len);
+        print_string(temp_string);
+        index += 3;
+        while (len > 0) {
+            chunk = (len > CAPTURE_BYTES_PER_LINE) ? CAPTURE_BYTES_PER_LINE : len;
+            pt = temp_string + sprintf(temp_string, "D,");
+            for (uint32_t i = 0; i < chunk; i++) {
+                pt += sprintf(pt, "%02X", capture_buffer[index++]);
+            }
+            sprintf(pt, "\n");
+            print_string(temp_string);
+            len -= chunk;
+        }
+    }
+}
+
+error_codes_te run_test_13(uint8_t mode_index, uint32_t parameter)
+{
+uint8_t     icon_string[3] = {BATTERY_HALF, GAMEPAD_CONNECTED, '\0'};
+uint32_t    nos_bytes;
+bool        overflow;
+
+#ifdef DISPLAY_ON_CORE1
+    print_string("Not available : display owned by core 1\n");
+    return OK;
+#endif
+    print_string("SSD1306 capture : decode with tools/ssd1306_emulator.py\n");
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        SSD1306_flush();        // start clean
+
+    // full screen : configuration and four rows of text
+
+        SSD1306_capture_start(capture_buffer, sizeof(capture_buffer));
+        SSD1306_command_seq(init_sequence, init_sequence_length);
+        SSD1306_scroll_area_reset();
+        SSD1306_command(SET_DISPLAY_ON);
+        SSD1306_write_string(1, ICON_ROW, icon_string, false);
+        SSD1306_write_string(0, MESSAGE_ROW, (const uint8_t *)"  Emulator    ", false);
+        SSD1306_write_string(0, SCROLL_ROW_UPPER, (const uint8_t *)" Menu entry 1 ", true);
+        SSD1306_write_string(2, SCROLL_ROW_LOWER, (const uint8_t *)"Font 12x16", false);
+        SSD1306_mark_all_dirty();
+        SSD1306_flush();
+        nos_bytes = SSD1306_capture_stop(&overflow);
+        print_capture("text", nos_bytes, overflow);
+
+    // a few changed characters
+
+        SSD1306_capture_start(capture_buffer, sizeof(capture_buffer));
+        SSD1306_write_cells(0, MESSAGE_ROW, 2, 3, (const uint8_t *)"EMU", false);
+        SSD1306_flush();
+        nos_bytes = SSD1306_capture_stop(&overflow);
+        print_capture("cells", nos_bytes, overflow);
+
+    // text at a pixel position that is not page aligned
+
+        SSD1306_capture_start(capture_buffer, sizeof(capture_buffer));
+        SSD1306_draw_text(FONT_6x8, 3, 21, (const uint8_t *)"draw_text y=21", 14, true);
+        SSD1306_flush();
+        nos_bytes = SSD1306_capture_stop(&overflow);
+        print_capture("draw_text", nos_bytes, overflow);
+
+    // graphics primitives
+
+        SSD1306_capture_start(capture_buffer, sizeof(capture_buffer));
+        Oled_Line(0, 63, 127, 32, INVERSE);
+        Oled_Circle(100, 47, 12, INVERSE);
+        Oled_FillRectangle(4, 36, 20, 60, INVERSE);
+        SSD1306_flush();
+        nos_bytes = SSD1306_capture_stop(&overflow);
+        print_capture("graphics", nos_bytes, overflow);
+
+    // scroll area moved up one row by start line : only new bottom row is sent
+
+        SSD1306_capture_start(capture_buffer, sizeof(capture_buffer));
+        SSD1306_scroll_area_step();
+        SSD1306_write_string(0, SCROLL_ROW_LOWER, (const uint8_t *)" Menu entry 2 ", false);
+        SSD1306_flush();
+        nos_bytes = SSD1306_capture_stop(&overflow);
+        print_capture("scroll", nos_bytes, overflow);
+        SSD1306_scroll_area_reset();
+    xSemaphoreGive(semaphore_SSD1306_display);
+    print_string("END\n");
+
+    LCD_refresh_all_rows();
+    return OK;
+}
+
+/**
+ * @brief Sprite animation
+ * 
+ * A spinner moves across the scroll area (at a non page aligned height)
+ * over a battery charge animation on the message row.  Sprites are
+ * updated every SPRITE_FRAME_MS and flushed by the display task.  Prints
+ * frames drawn and bus bytes/flushes for the run.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+#define     SPRITE_DEMO_MS      3000
+#define     SPRITE_DEMO_Y       38
+
+error_codes_te run_test_14(uint8_t mode_index, uint32_t parameter)
+{
+struct sprite_s             sprites[2];
+struct SSD1306_stats_s      before, after;
+TickType_t                  xLastWakeTime;
+uint32_t                    frames, index;
+int16_t                     x, dx;
+
+#ifdef DISPLAY_ON_CORE1
+    print_string("Not available : display owned by core 1\n");
+    return OK;
+#endif
+    DISABLE_SCROLLER;
+    vTaskDelay(2 * TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT);
+    LCD_set_refresh_class(LCD_CLASS_LIVE);
+
+    x = 0; dx = 2;
+    sprite_init(&sprites[0], &battery_charge_animation, (SSD1306_LCDWIDTH - 16), 16);
+    sprite_init(&sprites[1], &spinner_animation, x, SPRITE_DEMO_Y);
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+    frames = 0;
+    xLastWakeTime = xTaskGetTickCount();
+    for (index = 0; index < (SPRITE_DEMO_MS / SPRITE_FRAME_MS); index++) {
+        if (((x + dx) < 0) || ((x + dx) > (SSD1306_LCDWIDTH - 16))) {
+            dx = -dx;
+        }
+        x += dx;
+        sprite_move(&sprites[1], x, SPRITE_DEMO_Y);
+        if (sprite_update(sprites, 2) == true) {
+            frames++;
+        }
+        xTaskDelayUntil(&xLastWakeTime, (SPRITE_FRAME_MS / portTICK_PERIOD_MS));
+    }
+    sprite_hide(sprites, 2);
+    vTaskDelay(2 * TASK_DISPLAY_LCD_FREQUENCY_TICK_COUNT);
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        memcpy(&after, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+    xSemaphoreGive(semaphore_SSD1306_display);
+
+    sprintf(temp_string, "Frames,%u\nBytes/frame,%u\nFlushes,%u\nMax flush uS,%u\n",
+        frames,
+        (frames == 0) ? 0 : ((after.bytes_sent - before.bytes_sent) / frames),
+        after.flush_count - before.flush_count,
+        after.max_flush_us
+    );
+    print_string(temp_string);
+
+    LCD_set_refresh_class(LCD_CLASS_MENU);
+    LCD_refresh_all_rows();
+    return OK;
+}
+
+/**
+ * @brief Display write transaction benchmark
+ * 
+ * Clear the display and write an image (the display RAM copy), first
+ * with SSD1306_command()/SSD1306_WriteRam() at one transaction per byte,
+ * then as one command stream and one data stream, as the flush does.
+ * A flush of the whole RAM copy is shown for comparison, and also leaves
+ * the display as it was.
+ * 
+ * @param parameter 
+ * @return error_codes_te 
+ */
+static void write_screen(const uint8_t *image, bool streamed)
+{
+static const uint8_t    address_cmds[] = {
+    SET_COLUMN_ADDRESS, 0, (SSD1306_LCDWIDTH - 1),
+    SET_PAGE_ADDRESS, 0, (SSD1306_NOS_PAGES - 1)
+};
+static const uint8_t    blank_screen[SSD1306_RAM_SIZE] = {0};     // flash
+
+    if (streamed == true) {
+        SSD1306_command_seq(address_cmds, sizeof(address_cmds));
+        SSD1306_write_data(((image == NULL) ? blank_screen : image), SSD1306_RAM_SIZE);
+        return;
+    }
+    for (uint32_t index = 0; index < sizeof(address_cmds); index++) {
+        SSD1306_command(address_cmds[index]);
+    }
+    for (uint32_t index = 0; index < SSD1306_RAM_SIZE; index++) {
+        SSD1306_WriteRam((image == NULL) ? 0x00 : image[index]);
+    }
+}
+
+static void print_write_result(const char *name, uint32_t time_us, struct SSD1306_stats_s *before)
+{
+    sprintf(temp_string, "%s,%u,%u,%u\n",
+        name,
+        time_us,
+        SSD1306_stats.transactions - before->transactions,
+        SSD1306_stats.bytes_sent - before->bytes_sent
+    );
+    print_string(temp_string);
+}
+
+error_codes_te run_test_15(uint8_t mode_index, uint32_t parameter)
+{
+struct SSD1306_stats_s      before;
+uint32_t                    start_time;
+
+#ifdef DISPLAY_ON_CORE1
+    print_string("Not available : display owned by core 1\n");
+    return OK;
+#endif
+    print_string("Write,Time uS,Transactions,Bytes\n");
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        start_time = time_us_32();
+        write_screen(NULL, false);
+        print_write_result("Clear per byte", (time_us_32() - start_time), &before);
+
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        start_time = time_us_32();
+        write_screen(NULL, true);
+        print_write_result("Clear streamed", (time_us_32() - start_time), &before);
+
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        start_time = time_us_32();
+        write_screen(SSD1306_RAM, false);
+        print_write_result("Image per byte", (time_us_32() - start_time), &before);
+
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        start_time = time_us_32();
+        write_screen(SSD1306_RAM, true);
+        print_write_result("Image streamed", (time_us_32() - start_time), &before);
+
+    // whole RAM copy : also puts back scroll area order after hardware scroll steps
+
+        memcpy(&before, &SSD1306_stats, sizeof(struct SSD1306_stats_s));
+        start_time = time_us_32();
+        SSD1306_mark_all_dirty();
+        SSD1306_flush();
+        print_write_result("Image flush", (time_us_32() - start_time), &before);
+    xSemaphoreGive(semaphore_SSD1306_display);
     return OK;
 }
 
@@ -0,0 +1,283 @@
+/**
+ * @file    sprites.c
+ * @author  Jim Herd
+ * @brief   Animated sprites on SSD1306 display
+ *
+ * @note
+ * A sprite is an animation (a sequence of masked frames) at a position.
+ * Before a sprite is drawn, the display area under it is saved; it is
+ * restored before the sprite is redrawn at a new position or frame, or
+ * hidden.  Mask bits that are 0 let the background show through.
+ *
+ * Frames are composed in the display RAM copy with the display MUTEX
+ * held, and the display is only updated by the display task flush :
+ * the RAM copy is the back buffer, so a part drawn frame is never seen.
+ * Only the areas under the sprites are marked dirty, so a flush sends
+ * just the sprite bounding boxes.
+ *
+ * The owner of a list of sprites calls sprite_update() at a steady rate
+ * (SPRITE_FRAME_MS); each sprite changes frame at the rate of its own
+ * animation.  When any sprite in a list changes, the whole list is
+ * restored (last first) and redrawn (first first), so sprites in a list
+ * may overlap.
+ */
+
+#include <string.h>
+
+#include "system.h"
+#include "sprites.h"
+#include "sprite_images.h"
+#include "common.h"
+#include "SSD1306.h"
+#include "OLED_128X64.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+//==============================================================================
+// Animations
+//==============================================================================
+
+static const struct sprite_image_s spinner_frames[] = {
+    {spinner_0, spinner_mask}, {spinner_1, spinner_mask}, {spinner_2, spinner_mask}, {spinner_3, spinner_mask},
+    {spinner_4, spinner_mask}, {spinner_5, spinner_mask}, {spinner_6, spinner_mask}, {spinner_7, spinner_mask},
+};
+
+static const struct sprite_image_s battery_charge_frames[] = {
+    {battery_0, battery_mask}, {battery_1, battery_mask}, {battery_2, battery_mask},
+    {battery_3, battery_mask}, {battery_4, battery_mask},
+};
+
+const struct sprite_animation_s spinner_animation        = {16, 16, 8, 100, spinner_frames};
+const struct sprite_animation_s battery_charge_animation = {16, 16, 5, 400, battery_charge_frames};
+
+//==============================================================================
+// Local routines
+//==============================================================================
+/**
+ * @brief Display RAM area covered by a sprite, clipped to the display
+ * 
+ * @param sprite 
+ * @param x         left edge of sprite
+ * @param y         top edge of sprite
+ * @param area      first page, last page, first column, last column
+ * @return true     some of sprite is on the display
+ */
+static bool sprite_area(const struct sprite_s *sprite, int16_t x, int16_t y, int16_t *area)
+{
+    area[0] = (y >= 0) ? (y / 8) : -((7 - y) / 8);
+    area[1] = ((y + sprite->animation->height - 1) >= 0) ? ((y + sprite->animation->height - 1) / 8) : -1;
+    area[2] = (x < 0) ? 0 : x;
+    area[3] = x + sprite->animation->width - 1;
+    if (area[0] < 0) {
+        area[0] = 0;
+    }
+    if (area[1] >= SSD1306_NOS_PAGES) {
+        area[1] = SSD1306_NOS_PAGES - 1;
+    }
+    if (area[3] >= SSD1306_LCDWIDTH) {
+        area[3] = SSD1306_LCDWIDTH - 1;
+    }
+    return ((area[0] <= area[1]) && (area[2] <= area[3]));
+}
+
+/**
+ * @brief Save display area under sprite
+ * 
+ * @param sprite 
+ */
+static void save_background(struct sprite_s *sprite)
+{
+int16_t     area[4];
+uint8_t     *save_pt;
+
+    sprite->drawn_x = sprite->x;
+    sprite->drawn_y = sprite->y;
+    if (sprite_area(sprite, sprite->x, sprite->y, area) == false) {
+        return;
+    }
+    save_pt = sprite->background;
+    for (int16_t page = area[0]; page <= area[1]; page++) {
+        memcpy(save_pt, &SSD1306_RAM[(page * SSD1306_LCDWIDTH) + area[2]], (area[3] - area[2] + 1));
+        save_pt += (area[3] - area[2] + 1);
+    }
+}
+
+/**
+ * @brief Put back display area saved by save_background
+ * 
+ * @param sprite 
+ */
+static void restore_background(struct sprite_s *sprite)
+{
+int16_t     area[4];
+uint8_t     *save_pt;
+
+    if (sprite_area(sprite, sprite->drawn_x, sprite->drawn_y, area) == false) {
+        return;
+    }
+    save_pt = sprite->background;
+    for (int16_t page = area[0]; page <= area[1]; page++) {
+        memcpy(&SSD1306_RAM[(page * SSD1306_LCDWIDTH) + area[2]], save_pt, (area[3] - area[2] + 1));
+        save_pt += (area[3] - area[2] + 1);
+        SSD1306_mark_dirty(page, area[2], area[3]);
+    }
+}
+
+/**
+ * @brief Draw current frame of sprite through its mask
+ * 
+ * @param sprite 
+ */
+static void draw_sprite(struct sprite_s *sprite)
+{
+const struct sprite_animation_s *animation = sprite->animation;
+const struct sprite_image_s     *image = &animation->frames[sprite->frame];
+int16_t     top_page, page, column, area[4];
+uint8_t     shift, data, mask;
+uint32_t    index;
+
+    top_page = (sprite->y >= 0) ? (sprite->y / 8) : -((7 - sprite->y) / 8);
+    shift    = sprite->y - (top_page * 8);
+    for (uint8_t i = 0; i < (animation->height / 8); i++) {
+        page = top_page + i;
+        for (uint8_t j = 0; j < animation->width; j++) {
+            column = sprite->x + j;
+            if ((column < 0) || (column >= SSD1306_LCDWIDTH)) {
+                continue;
+            }
+            mask = (image->mask == NULL) ? 0xFF : image->mask[(i * animation->width) + j];
+            data = image->pixels[(i * animation->width) + j] & mask;
+            if ((page >= 0) && (page < SSD1306_NOS_PAGES)) {
+                index = (page * SSD1306_LCDWIDTH) + column;
+                SSD1306_RAM[index] = (SSD1306_RAM[index] & ~(uint8_t)(mask << shift)) | (uint8_t)(data << shift);
+            }
+            if ((shift != 0) && ((page + 1) >= 0) && ((page + 1) < SSD1306_NOS_PAGES)) {
+                index = ((page + 1) * SSD1306_LCDWIDTH) + column;
+                SSD1306_RAM[index] = (SSD1306_RAM[index] & ~(uint8_t)(mask >> (8 - shift))) | (uint8_t)(data >> (8 - shift));
+            }
+        }
+    }
+    if (sprite_area(sprite, sprite->x, sprite->y, area) == true) {
+        for (page = area[0]; page <= area[1]; page++) {
+            SSD1306_mark_dirty(page, area[2], area[3]);
+        }
+    }
+}
+
+//==============================================================================
+/**
+ * @brief Set up a sprite : drawn at next sprite_update()
+ * 
+ * @param sprite 
+ * @param animation     sequence of frames (max SPRITE_MAX_WIDTH x SPRITE_MAX_HEIGHT)
+ * @param x             left edge, pixels
+ * @param y             top edge, pixels
+ */
+void sprite_init(struct sprite_s *sprite, const struct sprite_animation_s *animation, int16_t x, int16_t y)
+{
+    sprite->animation       = animation;
+    sprite->x               = x;
+    sprite->y               = y;
+    sprite->frame           = 0;
+    sprite->next_frame_time = xTaskGetTickCount() + (animation->frame_ms / portTICK_PERIOD_MS);
+    sprite->changed         = true;
+    sprite->drawn           = false;
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Move sprite : redrawn at next sprite_update()
+ * 
+ * @param sprite 
+ * @param x             left edge, pixels
+ * @param y             top edge, pixels
+ */
+void sprite_move(struct sprite_s *sprite, int16_t x, int16_t y)
+{
+    if ((sprite->x != x) || (sprite->y != y)) {
+        sprite->x = x;
+        sprite->y = y;
+        sprite->changed = true;
+    }
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Advance animations and redraw sprites that have changed
+ * 
+ * @param sprites       list of sprites (first is drawn first, i.e. underneath)
+ * @param nos_sprites 
+ * @return true         display has changed
+ * 
+ * @note
+ * Call every SPRITE_FRAME_MS.  A frame time that has been missed by more
+ * than a frame is not caught up.
+ */
+bool sprite_update(struct sprite_s *sprites, uint8_t nos_sprites)
+{
+TickType_t  now, frame_ticks;
+bool        changed;
+uint8_t     index;
+
+    now = xTaskGetTickCount();
+    changed = false;
+    for (index = 0; index < nos_sprites; index++) {
+        frame_ticks = sprites[index].animation->frame_ms / portTICK_PERIOD_MS;
+        if ((int32_t)(now - sprites[index].next_frame_time) >= 0) {
+            sprites[index].frame = (sprites[index].frame + 1) % sprites[index].animation->nos_frames;
+            sprites[index].next_frame_time += frame_ticks;
+            if ((int32_t)(now - sprites[index].next_frame_time) >= 0) {
+                sprites[index].next_frame_time = now + frame_ticks;
+            }
+            sprites[index].changed = true;
+        }
+        if (sprites[index].changed == true) {
+            changed = true;
+        }
+    }
+    if (changed == false) {
+        return false;
+    }
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        for (index = nos_sprites; index > 0; index--) {
+            if (sprites[index - 1].drawn == true) {
+                restore_background(&sprites[index - 1]);
+            }
+        }
+        for (index = 0; index < nos_sprites; index++) {
+            save_background(&sprites[index]);
+            draw_sprite(&sprites[index]);
+            sprites[index].drawn   = true;
+            sprites[index].changed = false;
+        }
+    xSemaphoreGive(semaphore_SSD1306_display);
+    LCD_notify_update();
+    return true;
+}
+
+//==============================================================================
+/**
+ * @brief Remove sprites from display, restoring what was under them
+ * 
+ * @param sprites 
+ * @param nos_sprites 
+ */
+void sprite_hide(struct sprite_s *sprites, uint8_t nos_sprites)
+{
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        for (uint8_t index = nos_sprites; index > 0; index--) {
+            if (sprites[index - 1].drawn == true) {
+                restore_background(&sprites[index - 1]);
+                sprites[index - 1].drawn = false;
+            }
+            sprites[index - 1].changed = true;      // redrawn by a later update
+        }
+    xSemaphoreGive(semaphore_SSD1306_display);
+    LCD_notify_update();
+    return;
+}
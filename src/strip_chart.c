@@ -0,0 +1,178 @@
+/**
+ * @file    strip_chart.c
+ * @author  Jim Herd
+ * @brief   Scrolling strip chart of analogue channels on SSD1306 display
+ *
+ * @note
+ * The chart is a sweep display : new data is written at a cursor that
+ * moves left to right and wraps, so only one column is drawn per update
+ * rather than shifting the whole plot.  The display task is notified
+ * and its flush sends just the changed columns.
+ *
+ * Each column is the min/max of 'decimation' samples, so short spikes
+ * are not lost.  The range of a column includes the last sample of the
+ * previous column, which joins adjacent columns into a continuous trace.
+ *
+ * Channels are drawn in separate lanes, one above the other.  Values are
+ * 0 to 100%.  Columns are kept in a ring buffer so that the chart can be
+ * redrawn at any time.
+ */
+
+#include <string.h>
+
+#include "system.h"
+#include "strip_chart.h"
+#include "common.h"
+#include "OLED_128X64.h"
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+#define     NO_SAMPLE       0xFF
+
+//==============================================================================
+// Local routines
+//==============================================================================
+/**
+ * @brief Convert a value to a display row within a channel lane
+ * 
+ * Top row of each lane is left clear as a separator.
+ * 
+ * @param chart 
+ * @param channel   lane (0 is top)
+ * @param value     0 to 100%
+ * @return int16_t  y coordinate
+ */
+static int16_t value_to_y(struct strip_chart_s *chart, uint8_t channel, uint8_t value)
+{
+int16_t lane_height, lane_bottom;
+
+    lane_height = STRIP_CHART_HEIGHT / chart->nos_channels;
+    lane_bottom = STRIP_CHART_TOP + ((channel + 1) * lane_height) - 1;
+    return lane_bottom - ((value * (lane_height - 2)) / 100);
+}
+
+/**
+ * @brief Draw dotted sweep cursor
+ * 
+ * @param x     column
+ */
+static void draw_cursor(int16_t x)
+{
+    Oled_VLine(x, STRIP_CHART_TOP, (STRIP_CHART_TOP + STRIP_CHART_HEIGHT - 1), WHITE);
+    for (int16_t y = STRIP_CHART_TOP; y < (STRIP_CHART_TOP + STRIP_CHART_HEIGHT); y += 2) {
+        Oled_Pixel(x, y, BLACK);
+    }
+}
+
+/**
+ * @brief Draw one column from the ring buffer into the display RAM copy
+ * 
+ * @param chart 
+ * @param x     column
+ */
+static void draw_column(struct strip_chart_s *chart, int16_t x)
+{
+struct strip_chart_column_s *column;
+
+    column = &chart->column[x];
+    Oled_VLine(x, STRIP_CHART_TOP, (STRIP_CHART_TOP + STRIP_CHART_HEIGHT - 1), WHITE);
+    for (uint8_t channel = 0; channel < chart->nos_channels; channel++) {
+        if (column->min[channel] > column->max[channel]) {
+            continue;       // empty
+        }
+        Oled_VLine(x, value_to_y(chart, channel, column->max[channel]), value_to_y(chart, channel, column->min[channel]), BLACK);
+    }
+}
+
+//==============================================================================
+/**
+ * @brief Clear chart and its plot area
+ * 
+ * @param chart         chart data
+ * @param nos_channels  1 to STRIP_CHART_MAX_CHANNELS
+ * @param decimation    samples per column
+ */
+void strip_chart_init(struct strip_chart_s *chart, uint8_t nos_channels, uint8_t decimation)
+{
+    if (nos_channels > STRIP_CHART_MAX_CHANNELS) {
+        nos_channels = STRIP_CHART_MAX_CHANNELS;
+    }
+    chart->nos_channels = (nos_channels == 0) ? 1 : nos_channels;
+    chart->decimation   = (decimation == 0) ? 1 : decimation;
+    chart->sample_count = 0;
+    chart->cursor       = 0;
+    memset(chart->last, NO_SAMPLE, sizeof(chart->last));
+    for (uint32_t x = 0; x < STRIP_CHART_NOS_COLUMNS; x++) {
+        memset(chart->column[x].min, 0xFF, sizeof(chart->column[x].min));
+        memset(chart->column[x].max, 0x00, sizeof(chart->column[x].max));
+    }
+    strip_chart_redraw(chart);
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Add one sample of each channel
+ * 
+ * When a column is complete it is stored and drawn, and the cursor moves on.
+ * 
+ * @param chart 
+ * @param values    one value (0 to 100%) per channel
+ * @return true     column drawn
+ * @return false    column not yet complete
+ */
+bool strip_chart_add_sample(struct strip_chart_s *chart, const uint8_t *values)
+{
+uint8_t     value;
+
+    for (uint8_t channel = 0; channel < chart->nos_channels; channel++) {
+        value = (values[channel] > 100) ? 100 : values[channel];
+        if (chart->sample_count == 0) {
+            if (chart->last[channel] == NO_SAMPLE) {
+                chart->last[channel] = value;
+            }
+            chart->current.min[channel] = chart->last[channel];
+            chart->current.max[channel] = chart->last[channel];
+        }
+        if (value < chart->current.min[channel]) {
+            chart->current.min[channel] = value;
+        }
+        if (value > chart->current.max[channel]) {
+            chart->current.max[channel] = value;
+        }
+        chart->last[channel] = value;
+    }
+    chart->sample_count++;
+    if (chart->sample_count < chart->decimation) {
+        return false;
+    }
+    chart->sample_count = 0;
+    memcpy(&chart->column[chart->cursor], &chart->current, sizeof(struct strip_chart_column_s));
+
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        draw_column(chart, chart->cursor);
+        chart->cursor = (chart->cursor + 1) % STRIP_CHART_NOS_COLUMNS;
+        draw_cursor(chart->cursor);
+    xSemaphoreGive(semaphore_SSD1306_display);
+    LCD_notify_update();
+    return true;
+}
+
+//==============================================================================
+/**
+ * @brief Draw whole chart from the ring buffer
+ * 
+ * @param chart 
+ */
+void strip_chart_redraw(struct strip_chart_s *chart)
+{
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        for (int16_t x = 0; x < STRIP_CHART_NOS_COLUMNS; x++) {
+            draw_column(chart, x);
+        }
+        draw_cursor(chart->cursor);
+    xSemaphoreGive(semaphore_SSD1306_display);
+    LCD_notify_update();
+    return;
+}
@@ -0,0 +1,203 @@
+/**
+ * @file    telemetry.c
+ * @author  Jim Herd
+ * @brief   Binary framed telemetry on serial output
+ *
+ * @note
+ * Records are sent as binary frames instead of CSV text, so no time is
+ * spent formatting numbers and each sample costs a few bytes of serial
+ * bandwidth.  This allows logging at the sensor task rate.
+ *
+ * A frame is : record type, sequence number, time (uS), payload and a
+ * CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF) of all the
+ * preceding bytes.  The frame is COBS encoded, which removes all 0x00
+ * bytes, and a 0x00 delimiter is added.  A receiver can start at any
+ * point in the stream and find the next frame; lost bytes are seen as
+ * a bad CRC and gaps in the sequence number show lost frames.
+ *
+ * Frames go to the serial output task through print_bytes(), so they can
+ * be mixed with text only where the receiver knows to expect it.
+ * See tools/telemetry_decoder.py.
+ */
+
+#include <string.h>
+
+#include "system.h"
+#include "telemetry.h"
+#include "common.h"
+
+#include "pico/stdlib.h"
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+static uint8_t  sequence;
+
+//==============================================================================
+// Local routines
+//==============================================================================
+/**
+ * @brief CRC-16/CCITT-FALSE
+ * 
+ * @param data 
+ * @param length 
+ * @return uint16_t 
+ */
+static uint16_t crc16(const uint8_t *data, uint32_t length)
+{
+uint16_t    crc = 0xFFFF;
+
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= (uint16_t)data[i] << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+/**
+ * @brief Consistent Overhead Byte Stuffing encode
+ * 
+ * @param in 
+ * @param length 
+ * @param out       room for length + (length / 254) + 1 bytes
+ * @return uint32_t number of bytes in out (no delimiter)
+ * 
+ * @note
+ * Each run of up to 254 non-zero bytes is preceded by a code byte : the
+ * distance to the next zero (which is dropped) or to the end of frame.
+ */
+static uint32_t cobs_encode(const uint8_t *in, uint32_t length, uint8_t *out)
+{
+uint32_t    code_index, out_index;
+uint8_t     code;
+
+    code_index = 0;
+    out_index  = 1;
+    code       = 1;
+    for (uint32_t i = 0; i < length; i++) {
+        if (in[i] != 0) {
+            out[out_index++] = in[i];
+            code++;
+        }
+        if ((in[i] == 0) || (code == 0xFF)) {
+            out[code_index] = code;
+            code_index = out_index++;
+            code = 1;
+        }
+    }
+    out[code_index] = code;
+    return out_index;
+}
+
+//==============================================================================
+/**
+ * @brief Frame, encode and send a telemetry record
+ * 
+ * @param type      record type
+ * @param payload   record data (packed, little endian)
+ * @param length    bytes of payload (max TELEMETRY_MAX_PAYLOAD)
+ * @return error_codes_te 
+ */
+error_codes_te telemetry_send(telemetry_record_te type, const void *payload, uint32_t length)
+{
+uint8_t     frame[TELEMETRY_MAX_FRAME];
+uint8_t     encoded[TELEMETRY_MAX_FRAME + (TELEMETRY_MAX_FRAME / 254) + 2];
+uint32_t    time_stamp, nos_bytes;
+uint16_t    crc;
+
+    if (length > TELEMETRY_MAX_PAYLOAD) {
+        return TELEMETRY_RECORD_TOO_LONG;
+    }
+    time_stamp = time_us_32();
+    frame[0] = type;
+    frame[1] = sequence++;
+    memcpy(&frame[2], &time_stamp, sizeof(time_stamp));
+    memcpy(&frame[TELEMETRY_HEADER_SIZE], payload, length);
+    nos_bytes = TELEMETRY_HEADER_SIZE + length;
+    crc = crc16(frame, nos_bytes);
+    frame[nos_bytes++] = crc & 0xFF;
+    frame[nos_bytes++] = crc >> 8;
+
+    nos_bytes = cobs_encode(frame, nos_bytes, encoded);
+    encoded[nos_bytes++] = 0x00;
+    print_bytes(encoded, nos_bytes);
+    return OK;
+}
+
+//==============================================================================
+/**
+ * @brief Send processed value of all CD4051 channels
+ */
+void telemetry_send_analogue(void)
+{
+struct telemetry_analogue_s     record;
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        for (uint8_t i = 0; i < NOS_CD4051_CHANNELS; i++) {
+            record.value[i] = system_IO_data.analogue_global_data[i].processed.value;
+        }
+    xSemaphoreGive(semaphore_system_IO_data);
+    telemetry_send(TELEMETRY_ANALOGUE, &record, sizeof(record));
+}
+
+//==============================================================================
+/**
+ * @brief Send raw data and filter state of one CD4051 channel
+ * 
+ * @param channel 
+ */
+void telemetry_send_analogue_channel(uint8_t channel)
+{
+struct telemetry_analogue_channel_s     record;
+
+    record.channel = channel;
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        record.raw              = system_IO_data.analogue_global_data[channel].raw.current_value;
+        record.value            = system_IO_data.analogue_global_data[channel].processed.value;
+        record.glitch_threshold = system_IO_data.analogue_global_data[channel].raw.glitch_threshold;
+        record.glitch_count     = system_IO_data.analogue_global_data[channel].raw.glitch_count;
+        record.max_delta        = system_IO_data.analogue_global_data[channel].raw.max_delta;
+    xSemaphoreGive(semaphore_system_IO_data);
+    telemetry_send(TELEMETRY_ANALOGUE_CHANNEL, &record, sizeof(record));
+}
+
+//==============================================================================
+/**
+ * @brief Send motor state and motor command counts
+ */
+void telemetry_send_motor(void)
+{
+struct telemetry_motor_s    record;
+
+    xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+        for (uint8_t i = 0; i < NOS_ROBOKID_MOTORS; i++) {
+            record.motor[i].state     = system_IO_data.motor_data[i].motor_state;
+            record.motor[i].pwm_width = system_IO_data.motor_data[i].pwm_width;
+        }
+        record.commands_received = system_IO_data.motor_cmd_stats.commands_received;
+        record.commands_expired  = system_IO_data.motor_cmd_stats.commands_expired;
+    xSemaphoreGive(semaphore_system_IO_data);
+    telemetry_send(TELEMETRY_MOTOR, &record, sizeof(record));
+}
+
+//==============================================================================
+/**
+ * @brief Send stack and execution time data : one record per task
+ */
+void telemetry_send_tasks(void)
+{
+struct telemetry_task_s     record;
+
+    for (uint8_t index = 0; index < NOS_TASKS; index++) {
+        record.task = index;
+        xSemaphoreTake(semaphore_system_IO_data, portMAX_DELAY);
+            record.stack_high_water  = system_IO_data.task_data[index].StackHighWaterMark;
+            record.last_exec_time    = system_IO_data.task_data[index].last_exec_time;
+            record.lowest_exec_time  = system_IO_data.task_data[index].lowest_exec_time;
+            record.highest_exec_time = system_IO_data.task_data[index].highest_exec_time;
+        xSemaphoreGive(semaphore_system_IO_data);
+        telemetry_send(TELEMETRY_TASK, &record, sizeof(record));
+    }
+}
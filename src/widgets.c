@@ -0,0 +1,208 @@
+/**
+ * @file    widgets.c
+ * @author  Jim Herd
+ * @brief   Retained-mode widgets (labels, value fields, bars, icons) on SSD1306 display
+ *
+ * @note
+ * A screen is a constant table of widgets plus an array of widget state.
+ * Showing a screen clears its area, caches the bounding box of each
+ * widget and draws them all.  After that, a widget is only redrawn when
+ * its value changes, and only within its bounding box; a bar only redraws
+ * the span between its old and new length.
+ *
+ * Drawing is into the display RAM copy, so the flush by the display task
+ * sends just the changed areas.  The display task knows nothing about
+ * screens : a new screen is a new table.
+ *
+ * Values set with widget_set_value() are drawn together by
+ * widget_screen_update() with one lock and one display update.  A screen
+ * is only used by the task that shows it, so widget state has no lock.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "system.h"
+#include "widgets.h"
+#include "common.h"
+#include "SSD1306.h"
+#include "OLED_128X64.h"
+
+#include "FreeRTOS.h"
+#include "semphr.h"
+
+//==============================================================================
+// Local routines
+//==============================================================================
+/**
+ * @brief Calculate and cache bounding box of a widget
+ * 
+ * @param widget 
+ * @param state 
+ */
+static void layout_widget(const struct widget_s *widget, struct widget_state_s *state)
+{
+const struct font_metrics_s   *font = &font_metrics[widget->font];
+
+    switch (widget->type) {
+        case WIDGET_LABEL :
+            state->x2 = widget->x + (strlen(widget->text) * font->width) - 1;
+            state->y2 = widget->y + font->height - 1;
+            break;
+        case WIDGET_VALUE :
+            state->x2 = widget->x + (widget->size * font->width) - 1;
+            state->y2 = widget->y + font->height - 1;
+            break;
+        case WIDGET_BAR :
+            state->x2 = widget->x + widget->size - 1;
+            state->y2 = widget->y + widget->height - 1;
+            break;
+        case WIDGET_ICON :
+            state->x2 = widget->x + font->width - 1;
+            state->y2 = widget->y + font->height - 1;
+            break;
+    }
+}
+
+/**
+ * @brief Length of filled part of a bar
+ * 
+ * @param widget 
+ * @param value 
+ * @return int16_t  0 to (bar width - 2) pixels
+ */
+static int16_t bar_length(const struct widget_s *widget, int32_t value)
+{
+    if (value <= widget->min) {
+        return 0;
+    }
+    if (value >= widget->max) {
+        return widget->size - 2;
+    }
+    return ((value - widget->min) * (widget->size - 2)) / (widget->max - widget->min);
+}
+
+/**
+ * @brief Draw a widget into display RAM copy
+ * 
+ * @param widget 
+ * @param state 
+ * @param full      true : whole widget, false : only what the value changes
+ * 
+ * @note
+ * Caller must hold semaphore_SSD1306_display.
+ */
+static void draw_widget(const struct widget_s *widget, struct widget_state_s *state, bool full)
+{
+char        field[LCD_ROW_STRING_LENGTH];
+uint8_t     nos_chars, icon;
+int         length;
+int16_t     old_length, new_length;
+
+    switch (widget->type) {
+        case WIDGET_LABEL :
+            if (full == true) {
+                SSD1306_draw_text(widget->font, widget->x, widget->y, widget->text, strlen(widget->text), widget->invert);
+            }
+            break;
+        case WIDGET_VALUE :
+            nos_chars = (widget->size < sizeof(field)) ? widget->size : (sizeof(field) - 1);
+            length = snprintf(field, sizeof(field), widget->text, state->value);
+            if (length < nos_chars) {
+                memset(&field[length], ' ', (nos_chars - length));     // pad to width of field
+            }
+            SSD1306_draw_text(widget->font, widget->x, widget->y, field, nos_chars, widget->invert);
+            break;
+        case WIDGET_BAR :
+            new_length = bar_length(widget, state->value);
+            if (full == true) {
+                Oled_Rectangle(widget->x, widget->y, state->x2, state->y2, BLACK);
+                Oled_FillRectangle(widget->x + 1, widget->y + 1, state->x2 - 1, state->y2 - 1, WHITE);
+                old_length = 0;
+            } else {
+                old_length = bar_length(widget, state->drawn_value);
+            }
+            if (new_length > old_length) {
+                Oled_FillRectangle(widget->x + 1 + old_length, widget->y + 1, widget->x + new_length, state->y2 - 1, BLACK);
+            } else if (new_length < old_length) {
+                Oled_FillRectangle(widget->x + 1 + new_length, widget->y + 1, widget->x + old_length, state->y2 - 1, WHITE);
+            }
+            break;
+        case WIDGET_ICON :
+            icon = state->value;
+            SSD1306_draw_text(widget->font, widget->x, widget->y, &icon, 1, false);
+            break;
+    }
+    state->drawn_value = state->value;
+    state->dirty = false;
+}
+
+//==============================================================================
+/**
+ * @brief Clear screen area and draw all widgets of a screen
+ * 
+ * @param screen 
+ * 
+ * @note
+ * Set initial values with widget_set_value() before showing the screen.
+ */
+void widget_screen_show(struct widget_screen_s *screen)
+{
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        Oled_FillRectangle(0, screen->top, (SSD1306_LCDWIDTH - 1), (screen->top + screen->height - 1), WHITE);
+        for (uint8_t index = 0; index < screen->nos_widgets; index++) {
+            layout_widget(&screen->widgets[index], &screen->state[index]);
+            draw_widget(&screen->widgets[index], &screen->state[index], true);
+        }
+    xSemaphoreGive(semaphore_SSD1306_display);
+    LCD_notify_update();
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Set value of a widget
+ * 
+ * Widget is marked for redraw only if the value has changed.  Labels
+ * have no value.
+ * 
+ * @param screen 
+ * @param index     index of widget in screen table
+ * @param value     VALUE : printed value, BAR : position in range, ICON : character
+ */
+void widget_set_value(struct widget_screen_s *screen, uint8_t index, int32_t value)
+{
+    if ((index >= screen->nos_widgets) || (screen->widgets[index].type == WIDGET_LABEL)) {
+        return;
+    }
+    if (screen->state[index].value != value) {
+        screen->state[index].value = value;
+        screen->state[index].dirty = true;
+    }
+    return;
+}
+
+//==============================================================================
+/**
+ * @brief Redraw widgets whose values have changed
+ * 
+ * @param screen 
+ */
+void widget_screen_update(struct widget_screen_s *screen)
+{
+bool    changed;
+
+    changed = false;
+    xSemaphoreTake(semaphore_SSD1306_display, portMAX_DELAY);
+        for (uint8_t index = 0; index < screen->nos_widgets; index++) {
+            if (screen->state[index].dirty == true) {
+                draw_widget(&screen->widgets[index], &screen->state[index], false);
+                changed = true;
+            }
+        }
+    xSemaphoreGive(semaphore_SSD1306_display);
+    if (changed == true) {
+        LCD_notify_update();
+    }
+    return;
+}
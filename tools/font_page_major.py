@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+@file    font_page_major.py
+@author  Jim Herd
+@brief   Generate page-major copies of the fonts in include/font.h
+
+GLCD Font Creator stores each glyph column by column : for a 16 pixel
+high font, byte 0 is page 0 of column 0, byte 1 is page 1 of column 0,
+and so on.  SSD1306_write_string() outputs a page at a time, so this
+layout means a strided read of each glyph.
+
+This script rewrites each font so that each glyph is stored page by page,
+each page being a contiguous run of 'width' bytes :
+
+    header      width, height, first char, last char
+    glyph       page 0 : column 0 .. width-1
+                page 1 : column 0 .. width-1
+                ...
+
+Usage (from repository root) :
+
+    python3 tools/font_page_major.py include/font.h include/font_page_major.h
+
+Re-run whenever a font in font.h is changed.
+"""
+
+import re
+import sys
+
+#
+# Fonts to convert : source name, width, height, first char, last char.
+# Fonts with a 4-byte header in font.h are marked 'True'.
+#
+FONTS = [
+    ("Terminal_9x16",                   9, 16, 32, 126, True),
+    ("robokid_LCD_icons_font_15x16",   15, 16, 32, 126, True),
+    ("Terminal_12x16",                 12, 16, 32, 127, False),
+    ("Font_6x8",                        6,  8, 32, 127, False),
+    ("Segment_25x40",                  25, 40, 46,  58, False),
+]
+
+
+def read_font(source, name, has_header):
+    """Return list of glyph bytes of a font array in font.h"""
+    match = re.search(r"const unsigned char " + name + r"\[\]\s*=\s*\{(.*?)\};", source, re.S)
+    if match is None:
+        sys.exit("font %s not found" % name)
+    lines = match.group(1).splitlines()
+    if has_header:
+        lines = [line for line in lines if "header" not in line]
+    body = "\n".join(re.sub(r"//.*", "", line) for line in lines)
+    return [int(value, 16) for value in re.findall(r"0x[0-9A-Fa-f]{2}", body)]
+
+
+def page_major(data, width, height, nos_chars):
+    """Transpose each glyph from column-major to page-major"""
+    nos_pages = height // 8
+    glyph_size = width * nos_pages
+    if len(data) < glyph_size * nos_chars:
+        sys.exit("font data too short : %d < %d" % (len(data), glyph_size * nos_chars))
+    result = []
+    for char in range(nos_chars):
+        glyph = data[char * glyph_size:(char + 1) * glyph_size]
+        for page in range(nos_pages):
+            result.extend(glyph[(column * nos_pages) + page] for column in range(width))
+    return result
+
+
+def write_font(out, name, width, height, first, last, data):
+    glyph_size = width * (height // 8)
+    out.write("const unsigned char %s_page_major[] = {\n" % name)
+    out.write("%d, %d, %d, %d,        // header\n" % (width, height, first, last))
+    for char in range(last - first + 1):
+        glyph = data[char * glyph_size:(char + 1) * glyph_size]
+        for index in range(0, glyph_size, width):          # one line per glyph page
+            chunk = glyph[index:index + width]
+            out.write(", ".join("0x%02X" % value for value in chunk) + ",")
+            if index == 0:
+                out.write("  // char %d" % (first + char))
+            out.write("\n")
+    out.write("};\n\n")
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit("usage : font_page_major.py <font.h> <output.h>")
+    source = open(sys.argv[1]).read()
+    with open(sys.argv[2], "w") as out:
+        out.write("/**\n")
+        out.write(" * @file    font_page_major.h\n")
+        out.write(" * @brief   Page-major copies of fonts in font.h\n")
+        out.write(" *\n")
+        out.write(" * GENERATED by tools/font_page_major.py : do not edit\n")
+        out.write(" */\n\n")
+        out.write("#ifndef __FONT_PAGE_MAJOR_H__\n")
+        out.write("#define __FONT_PAGE_MAJOR_H__\n\n")
+        for name, width, height, first, last, has_header in FONTS:
+            data = read_font(source, name, has_header)
+            data = page_major(data, width, height, last - first + 1)
+            write_font(out, name, width, height, first, last, data)
+        out.write("#endif  /* __FONT_PAGE_MAJOR_H__ */\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,32 @@
+/**
+ * @file    FreeRTOS.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for FreeRTOS : types only, scheduler never runs
+ */
+
+#ifndef __HOST_FREERTOS_H__
+#define __HOST_FREERTOS_H__
+
+#include    <stdint.h>
+
+typedef uint32_t    TickType_t;
+typedef long        BaseType_t;
+typedef unsigned long UBaseType_t;
+typedef void        *TaskHandle_t;
+typedef void        *SemaphoreHandle_t;
+typedef void        *QueueHandle_t;
+typedef void        *EventGroupHandle_t;
+typedef TickType_t  EventBits_t;
+typedef uint32_t    StackType_t;
+
+#define configSTACK_DEPTH_TYPE      uint16_t
+
+#define portTICK_PERIOD_MS          1
+#define portMAX_DELAY               0xFFFFFFFFUL
+#define pdTRUE                      1
+#define pdFALSE                     0
+#define portYIELD_FROM_ISR(x)       (void)(x)
+#define taskENTER_CRITICAL()
+#define taskEXIT_CRITICAL()
+
+#endif  /* __HOST_FREERTOS_H__ */
@@ -0,0 +1,7 @@
+/**
+ * @file    event_groups.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for FreeRTOS : types only
+ */
+
+#include    "FreeRTOS.h"
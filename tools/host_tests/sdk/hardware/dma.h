@@ -0,0 +1,27 @@
+/**
+ * @file    dma.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for the Pico SDK : DMA calls used by the display driver
+ */
+
+#ifndef __HOST_HARDWARE_DMA_H__
+#define __HOST_HARDWARE_DMA_H__
+
+#include    "pico/stdlib.h"
+
+typedef struct { uint32_t ctrl; } dma_channel_config;
+
+enum { DMA_SIZE_8, DMA_SIZE_16, DMA_SIZE_32 };
+
+int                dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(uint channel);
+void               channel_config_set_transfer_data_size(dma_channel_config *c, int size);
+void               channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void               channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void               channel_config_set_dreq(dma_channel_config *c, uint dreq);
+void               dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                                         const volatile void *read_addr, uint transfer_count, bool trigger);
+void               dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count);
+void               dma_channel_abort(uint channel);
+
+#endif  /* __HOST_HARDWARE_DMA_H__ */
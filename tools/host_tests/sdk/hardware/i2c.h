@@ -0,0 +1,32 @@
+/**
+ * @file    i2c.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for the Pico SDK : I2C registers used by the display driver
+ */
+
+#ifndef __HOST_HARDWARE_I2C_H__
+#define __HOST_HARDWARE_I2C_H__
+
+#include    "pico/stdlib.h"
+
+typedef struct i2c_inst i2c_inst_t;
+extern i2c_inst_t *i2c0;
+
+typedef struct {
+    volatile uint32_t   tar, data_cmd, intr_mask, raw_intr_stat;
+    volatile uint32_t   clr_tx_abrt, clr_stop_det, enable, dma_cr;
+} i2c_hw_t;
+
+#define I2C_IC_DATA_CMD_STOP_BITS           0x200
+#define I2C_IC_RAW_INTR_STAT_TX_ABRT_BITS   0x40
+#define I2C_IC_RAW_INTR_STAT_STOP_DET_BITS  0x200
+#define I2C_IC_INTR_MASK_M_STOP_DET_BITS    0x200
+#define I2C_IC_INTR_MASK_M_TX_ABRT_BITS     0x40
+#define I2C_IC_DMA_CR_TDMAE_BITS            0x2
+
+uint      i2c_init(i2c_inst_t *i2c, uint baudrate);
+uint      i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate);
+i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c);
+uint      i2c_get_dreq(i2c_inst_t *i2c, bool is_tx);
+
+#endif  /* __HOST_HARDWARE_I2C_H__ */
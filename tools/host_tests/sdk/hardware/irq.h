@@ -0,0 +1,19 @@
+/**
+ * @file    irq.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for the Pico SDK : interrupt set-up
+ */
+
+#ifndef __HOST_HARDWARE_IRQ_H__
+#define __HOST_HARDWARE_IRQ_H__
+
+#include    "pico/stdlib.h"
+
+#define I2C0_IRQ    23
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_set_enabled(uint num, bool enabled);
+
+#endif  /* __HOST_HARDWARE_IRQ_H__ */
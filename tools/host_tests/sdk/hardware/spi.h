@@ -0,0 +1,5 @@
+/**
+ * @file    spi.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for the Pico SDK : SPI is not used on the host
+ */
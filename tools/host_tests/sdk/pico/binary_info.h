@@ -0,0 +1,5 @@
+/**
+ * @file    binary_info.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for the Pico SDK : empty
+ */
@@ -0,0 +1,26 @@
+/**
+ * @file    stdlib.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for the Pico SDK : just what the display driver uses
+ */
+
+#ifndef __HOST_PICO_STDLIB_H__
+#define __HOST_PICO_STDLIB_H__
+
+#include    <stdint.h>
+#include    <stdbool.h>
+#include    <stddef.h>
+
+typedef unsigned int uint;
+
+enum { GPIO_FUNC_SPI, GPIO_FUNC_UART, GPIO_FUNC_I2C, GPIO_FUNC_PWM };
+
+uint32_t time_us_32(void);
+void     sleep_us(uint64_t us);
+void     sleep_ms(uint32_t ms);
+void     tight_loop_contents(void);
+uint     get_core_num(void);
+void     gpio_set_function(uint gpio, int function);
+void     gpio_pull_up(uint gpio);
+
+#endif  /* __HOST_PICO_STDLIB_H__ */
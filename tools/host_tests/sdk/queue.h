@@ -0,0 +1,7 @@
+/**
+ * @file    queue.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for FreeRTOS : types only
+ */
+
+#include    "FreeRTOS.h"
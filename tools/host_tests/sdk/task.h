@@ -0,0 +1,20 @@
+/**
+ * @file    task.h
+ * @author  Jim Herd
+ * @brief   Host stand-in for FreeRTOS : task calls used by the display driver
+ */
+
+#ifndef __HOST_TASK_H__
+#define __HOST_TASK_H__
+
+#include    "FreeRTOS.h"
+
+#define taskSCHEDULER_NOT_STARTED   1
+#define taskSCHEDULER_RUNNING       2
+
+BaseType_t   xTaskGetSchedulerState(void);
+TaskHandle_t xTaskGetCurrentTaskHandle(void);
+uint32_t     ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t wait);
+void         vTaskNotifyGiveIndexedFromISR(TaskHandle_t task, UBaseType_t index, BaseType_t *woken);
+
+#endif  /* __HOST_TASK_H__ */
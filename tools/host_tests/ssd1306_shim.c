@@ -0,0 +1,117 @@
+/**
+ * @file    ssd1306_shim.c
+ * @author  Jim Herd
+ * @brief   Host I2C/DMA shim for the SSD1306 driver
+ *
+ * @note
+ * SSD1306.c and OLED_128X64.c are built unchanged against the headers in
+ * sdk/.  The scheduler is never started, so SSD1306_i2c_write() takes
+ * its polled path : the DMA start below is the end of the transfer.
+ * Each transfer is decoded from the 16-bit I2C data/command words and
+ * printed in the TEST mode 13 format read by tools/ssd1306_emulator.py :
+ *
+ *      T,<control byte>,<length>
+ *      D,<up to 32 bytes in hex>
+ */
+
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+#include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+#include "system.h"
+#include "common.h"
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define     BYTES_PER_LINE      32
+
+static i2c_hw_t     i2c_hw = {
+    .raw_intr_stat = I2C_IC_RAW_INTR_STAT_STOP_DET_BITS,    // every transfer ends at once with a STOP
+};
+
+i2c_inst_t          *i2c0;
+uint32_t            shim_errors;
+
+//==============================================================================
+// I2C and DMA : a transfer is printed when it is started
+//==============================================================================
+
+i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c)                           { (void)i2c; return &i2c_hw; }
+uint i2c_init(i2c_inst_t *i2c, uint baudrate)                   { (void)i2c; return baudrate; }
+uint i2c_set_baudrate(i2c_inst_t *i2c, uint baudrate)           { (void)i2c; return baudrate; }
+uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx)                  { (void)i2c; (void)is_tx; return 0; }
+
+int dma_claim_unused_channel(bool required)                     { (void)required; return 0; }
+dma_channel_config dma_channel_get_default_config(uint channel) { dma_channel_config c = {channel}; return c; }
+void channel_config_set_transfer_data_size(dma_channel_config *c, int size)    { (void)c; (void)size; }
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)       { (void)c; (void)incr; }
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)      { (void)c; (void)incr; }
+void channel_config_set_dreq(dma_channel_config *c, uint dreq)                 { (void)c; (void)dreq; }
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger)
+{
+    (void)channel; (void)config; (void)write_addr; (void)read_addr; (void)transfer_count; (void)trigger;
+}
+void dma_channel_abort(uint channel)                            { (void)channel; }
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count)
+{
+const volatile uint16_t *words = read_addr;
+uint32_t    index, chunk;
+
+    (void)channel;
+    if ((transfer_count < 2) || ((words[transfer_count - 1] & I2C_IC_DATA_CMD_STOP_BITS) == 0)) {
+        fprintf(stderr, "shim : transfer of %u words without STOP on last byte\n", transfer_count);
+        shim_errors++;
+    }
+    printf("T,%02X,%u\n", (words[0] & 0xFF), (transfer_count - 1));
+    for (index = 1; index < transfer_count; index += chunk) {
+        chunk = ((transfer_count - index) > BYTES_PER_LINE) ? BYTES_PER_LINE : (transfer_count - index);
+        printf("D,");
+        for (uint32_t i = 0; i < chunk; i++) {
+            printf("%02X", (words[index + i] & 0xFF));
+        }
+        printf("\n");
+    }
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) { (void)num; (void)handler; }
+void irq_set_enabled(uint num, bool enabled)                    { (void)num; (void)enabled; }
+
+//==============================================================================
+// Rest of the SDK, FreeRTOS and firmware calls made by the driver
+//==============================================================================
+
+uint32_t time_us_32(void)                                       { return 0; }
+void sleep_us(uint64_t us)                                      { (void)us; }
+void sleep_ms(uint32_t ms)                                      { (void)ms; }
+void tight_loop_contents(void)                                  { }
+uint get_core_num(void)                                         { return 0; }
+void gpio_set_function(uint gpio, int function)                 { (void)gpio; (void)function; }
+void gpio_pull_up(uint gpio)                                    { (void)gpio; }
+
+BaseType_t xTaskGetSchedulerState(void)                         { return taskSCHEDULER_NOT_STARTED; }
+TaskHandle_t xTaskGetCurrentTaskHandle(void)                    { return NULL; }
+uint32_t ulTaskNotifyTakeIndexed(UBaseType_t index, BaseType_t clear, TickType_t wait)
+{
+    (void)index; (void)clear; (void)wait;
+    return 0;
+}
+void vTaskNotifyGiveIndexedFromISR(TaskHandle_t task, UBaseType_t index, BaseType_t *woken)
+{
+    (void)task; (void)index; (void)woken;
+}
+
+void LCD_update_begin(void)                                     { }
+void LCD_update_end(void)                                       { }
+void LCD_update_scroller(uint8_t nos_strings, const char **scroll_strings)     { (void)nos_strings; (void)scroll_strings; }
+
+void log_error(error_codes_te error_code, task_t task)
+{
+    fprintf(stderr, "shim : log_error(%d, %d)\n", error_code, task);
+    shim_errors++;
+}
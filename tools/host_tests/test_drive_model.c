@@ -0,0 +1,311 @@
+/**
+ * @file    test_drive_model.c
+ * @author  Jim Herd
+ * @brief   Host check of the integer drive model against floating point
+ *
+ * @note
+ * Builds src/drive_model.c with the host compiler and compares each
+ * function with a double precision model of the same thing :
+ *
+ *      wheel_speed_mm_s / wheel_pwm_for_speed  : linear motor model
+ *      odometry_sin / odometry_cos             : sin() / cos()
+ *      odometry_step                           : exact arc integration
+ *      motion_profile_speed                    : continuous time profile
+ *      motor_watchdog_expired                  : TIMEOUT + CHECK bound
+ *
+ * Run with "make -C tools/host_tests".  Each check prints PASS or FAIL
+ * with the worst error found; exit status is the number of failures.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "drive_model.h"
+
+#define     PI      3.14159265358979
+
+static int  failures;
+
+//==============================================================================
+
+static void check(const char *name, double error, double limit)
+{
+    printf("%s  %-40s error %10.4f  limit %10.4f\n", (error <= limit) ? "PASS" : "FAIL", name, error, limit);
+    if (error > limit) {
+        failures++;
+    }
+}
+
+static double model_wheel_speed(int pwm_width)
+{
+double  width;
+
+    width = fabs((double)pwm_width);
+    if (width <= MOTOR_DEADBAND_PERCENT) {
+        return 0.0;
+    }
+    if (width > 100.0) {
+        width = 100.0;
+    }
+    width = (width - MOTOR_DEADBAND_PERCENT) * WHEEL_SPEED_AT_FULL_PWM_MM_S / (100.0 - MOTOR_DEADBAND_PERCENT);
+    return (pwm_width < 0) ? -width : width;
+}
+
+//==============================================================================
+// Motor model : integer result is truncated, so within 1mm/S.  Speed to
+// PWM and back is within half a PWM step.
+
+static void test_motor_model(void)
+{
+int     pwm, speed;
+double  error, worst;
+
+    worst = 0.0;
+    for (pwm = -128; pwm <= 127; pwm++) {
+        error = fabs(wheel_speed_mm_s(pwm) - model_wheel_speed(pwm));
+        if (error > worst) worst = error;
+    }
+    check("wheel_speed_mm_s (mm/S)", worst, 1.0);
+
+    worst = 0.0;
+    for (speed = -WHEEL_SPEED_AT_FULL_PWM_MM_S; speed <= WHEEL_SPEED_AT_FULL_PWM_MM_S; speed++) {
+        if (abs(speed) < 10) {
+            continue;           // inside the deadband step
+        }
+        error = fabs(model_wheel_speed(wheel_pwm_for_speed(speed)) - speed);
+        if (error > worst) worst = error;
+    }
+    check("wheel_pwm_for_speed round trip (mm/S)", worst,
+          0.5 * WHEEL_SPEED_AT_FULL_PWM_MM_S / (100.0 - MOTOR_DEADBAND_PERCENT) + 0.01);
+}
+
+//==============================================================================
+// Q15 sine : interpolated quarter table, every binary angle
+
+static void test_sine(void)
+{
+unsigned    angle;
+double      radians, error, worst;
+
+    worst = 0.0;
+    for (angle = 0; angle < 65536; angle++) {
+        radians = angle * (2.0 * PI / 65536.0);
+        error = fabs((odometry_sin(angle) / 32767.0) - sin(radians));
+        if (error > worst) worst = error;
+        error = fabs((odometry_cos(angle) / 32767.0) - cos(radians));
+        if (error > worst) worst = error;
+    }
+    check("odometry_sin/cos (x 1e-4)", worst * 1e4, 1.5);
+}
+
+//==============================================================================
+// Pose integration : run a PWM sequence through both models.  The float
+// model integrates each tick as an exact arc using the same wheel
+// speeds, so only the integration step is compared.
+
+struct float_pose_s {
+    double  x_mm, y_mm, heading, distance_mm;
+} ;
+
+static void model_step(struct float_pose_s *pose, int left_speed, int right_speed)
+{
+double  dt, v, w, new_heading;
+
+    dt = 1.0 / ODOMETRY_FREQUENCY;
+    v  = (left_speed + right_speed) / 2.0;
+    w  = (right_speed - left_speed) / (double)WHEEL_TRACK_MM;
+    new_heading = pose->heading + (w * dt);
+    if (fabs(w) < 1e-9) {
+        pose->x_mm += v * dt * cos(pose->heading);
+        pose->y_mm += v * dt * sin(pose->heading);
+    } else {
+        pose->x_mm += (v / w) * (sin(new_heading) - sin(pose->heading));
+        pose->y_mm -= (v / w) * (cos(new_heading) - cos(pose->heading));
+    }
+    pose->heading = new_heading;
+    pose->distance_mm += fabs(v * dt);
+}
+
+static void run_pose(const char *name, const int8_t (*pwm)[3], double position_limit, double heading_limit)
+{
+struct pose_s       pose = {0};
+struct float_pose_s model = {0};
+int16_t             left_speed, right_speed;
+int                 ticks;
+double              heading_error, position_error, worst_position, worst_heading;
+char                label[64];
+
+    worst_position = 0.0;
+    worst_heading  = 0.0;
+    for (; pwm[0][0] != 0; pwm++) {
+        left_speed  = wheel_speed_mm_s(pwm[0][1]);
+        right_speed = wheel_speed_mm_s(pwm[0][2]);
+        for (ticks = 0; ticks < pwm[0][0] * ODOMETRY_FREQUENCY / 10; ticks++) {
+            odometry_step(&pose, left_speed, right_speed);
+            model_step(&model, left_speed, right_speed);
+
+            position_error = hypot((pose.x_um / 1000.0) - model.x_mm, (pose.y_um / 1000.0) - model.y_mm);
+            heading_error  = (pose.heading * (2.0 * PI / 4294967296.0)) - fmod(model.heading, 2.0 * PI);
+            heading_error  = fabs(remainder(heading_error, 2.0 * PI)) * (180.0 / PI);
+            if (position_error > worst_position) worst_position = position_error;
+            if (heading_error > worst_heading)   worst_heading  = heading_error;
+        }
+    }
+    snprintf(label, sizeof(label), "%s position (mm)", name);
+    check(label, worst_position, position_limit);
+    snprintf(label, sizeof(label), "%s heading (deg)", name);
+    check(label, worst_heading, heading_limit);
+    snprintf(label, sizeof(label), "%s distance (mm)", name);
+    check(label, fabs((pose.distance_mm + (pose.distance_um / 1000.0)) - model.distance_mm), 1.0);
+}
+
+// { time in 1/10 S, left PWM, right PWM }, terminated by zero time
+
+static const int8_t straight[][3] = {{100, 60, 60}, {50, -80, -80}, {0}};
+static const int8_t spin[][3]     = {{80, -60, 60}, {80, 100, -100}, {0}};
+static const int8_t arc[][3]      = {{120, 40, 90}, {120, 90, 40}, {0}};
+static const int8_t square[][3]   = {
+    {30, 70, 70}, {7, -70, 70}, {30, 70, 70}, {7, -70, 70},
+    {30, 70, 70}, {7, -70, 70}, {30, 70, 70}, {7, -70, 70}, {0}
+};
+
+static void test_pose(void)
+{
+    run_pose("straight", straight, 0.05, 0.01);
+    run_pose("spin",     spin,     0.05, 0.02);
+    run_pose("arc",      arc,      0.5,  0.01);
+    run_pose("square",   square,   1.0,  0.01);
+}
+
+//==============================================================================
+// Speed profile : drive a straight primitive through the motor model and
+// odometry, as Task_motion does, and compare arrival time with the same
+// profile in continuous time with an ideal motor.
+
+static double model_profile_time(int target_mm, int max_speed)
+{
+double  t, dt, travelled, speed;
+
+    dt = 1e-4;
+    t = 0.0;
+    travelled = 0.0;
+    while (travelled < target_mm) {
+        speed = MOTION_MIN_SPEED_MM_S + (MOTION_ACCEL_MM_S_PER_TICK * MOTION_FREQUENCY * t);
+        if (speed > max_speed) {
+            speed = max_speed;
+        }
+        if (speed > MOTION_MIN_SPEED_MM_S + ((target_mm - travelled) * MOTION_SLOWDOWN_GAIN)) {
+            speed = MOTION_MIN_SPEED_MM_S + ((target_mm - travelled) * MOTION_SLOWDOWN_GAIN);
+        }
+        travelled += speed * dt;
+        t += dt;
+    }
+    return t;
+}
+
+static void run_profile(int target_mm, int max_speed)
+{
+struct pose_s   pose = {0};
+int32_t         speed, peak, remaining_mm, expected_ms;
+int16_t         wheel;
+int             ticks;
+double          time_s, model_s;
+char            label[64];
+
+    speed = MOTION_MIN_SPEED_MM_S;
+    peak  = 0;
+    for (ticks = 0; ; ticks++) {
+        remaining_mm = target_mm - (int32_t)pose.distance_mm;
+        if (remaining_mm <= 0) {
+            break;
+        }
+        speed = motion_profile_speed(speed, max_speed, remaining_mm);
+        if (speed > peak) peak = speed;
+        wheel = wheel_speed_mm_s(wheel_pwm_for_speed(speed));
+        odometry_step(&pose, wheel, wheel);
+    }
+    time_s  = (double)ticks / MOTION_FREQUENCY;
+    model_s = model_profile_time(target_mm, max_speed);
+    expected_ms = (target_mm * 1000) / max_speed;
+
+    snprintf(label, sizeof(label), "profile %4dmm @%3d time (S)", target_mm, max_speed);
+    check(label, fabs(time_s - model_s), (0.03 * model_s) + (2.0 / MOTION_FREQUENCY));
+    snprintf(label, sizeof(label), "profile %4dmm @%3d overshoot (mm)", target_mm, max_speed);
+    check(label, (double)pose.distance_mm - target_mm, 1.0);
+    snprintf(label, sizeof(label), "profile %4dmm @%3d peak over max", target_mm, max_speed);
+    check(label, (peak > max_speed) ? (double)(peak - max_speed) : 0.0, 0.0);
+    snprintf(label, sizeof(label), "profile %4dmm @%3d time / timeout", target_mm, max_speed);
+    check(label, (time_s * 1000.0) / ((expected_ms * MOTION_TIMEOUT_FACTOR) + 1000), 0.5);
+}
+
+static void test_profile(void)
+{
+    run_profile(10,   150);
+    run_profile(100,  150);
+    run_profile(500,  150);
+    run_profile(500,  WHEEL_SPEED_AT_FULL_PWM_MM_S);
+    run_profile(2000, WHEEL_SPEED_AT_FULL_PWM_MM_S);
+}
+
+//==============================================================================
+// Motor watchdog : run the check at MOTOR_WATCHDOG_CHECK_MS intervals from
+// every timer phase (1uS steps) and at the 32-bit uS wrap.  The brake must
+// come after TIMEOUT and no later than TIMEOUT + CHECK.  A stopped motor,
+// or one fed inside the timeout, must never trip.
+
+static uint32_t watchdog_reaction_us(uint32_t command_us, uint32_t phase_us, bool running, uint32_t feed_us)
+{
+uint32_t    now_us, last_command_us;
+
+    last_command_us = command_us;
+    for (now_us = command_us + phase_us; (now_us - command_us) < 10000000; now_us += MOTOR_WATCHDOG_CHECK_MS * 1000) {
+        if ((feed_us != 0) && ((now_us - last_command_us) >= feed_us)) {
+            last_command_us = now_us;
+        }
+        if (motor_watchdog_expired(running, now_us - last_command_us) == true) {
+            return now_us - command_us;
+        }
+    }
+    return 0;
+}
+
+static void test_watchdog(void)
+{
+uint32_t    phase, reaction, earliest, latest, trips;
+static const uint32_t command_times[] = {0, 123456789, 0xFFFFFFFF - 100000};
+unsigned    index;
+
+    earliest = 0xFFFFFFFF;
+    latest   = 0;
+    for (index = 0; index < (sizeof(command_times) / sizeof(command_times[0])); index++) {
+        for (phase = 0; phase < MOTOR_WATCHDOG_CHECK_MS * 1000; phase++) {
+            reaction = watchdog_reaction_us(command_times[index], phase, true, 0);
+            if (reaction < earliest) earliest = reaction;
+            if (reaction > latest)   latest   = reaction;
+        }
+    }
+    check("watchdog reaction, latest (mS)", latest / 1000.0, MOTOR_WATCHDOG_TIMEOUT_MS + MOTOR_WATCHDOG_CHECK_MS);
+    check("watchdog reaction, early by (mS)",
+          (earliest > (MOTOR_WATCHDOG_TIMEOUT_MS * 1000)) ? 0.0 : ((MOTOR_WATCHDOG_TIMEOUT_MS * 1000) - earliest) / 1000.0, 0.0);
+
+    trips = 0;
+    for (phase = 0; phase < MOTOR_WATCHDOG_CHECK_MS * 1000; phase += 7) {
+        trips += (watchdog_reaction_us(0xFFFFFFFF - 100000, phase, false, 0) != 0);
+        trips += (watchdog_reaction_us(0xFFFFFFFF - 100000, phase, true, (MOTOR_WATCHDOG_TIMEOUT_MS - MOTOR_WATCHDOG_CHECK_MS) * 1000) != 0);
+    }
+    check("watchdog trips when stopped or fed", trips, 0.0);
+}
+
+//==============================================================================
+
+int main(void)
+{
+    test_motor_model();
+    test_sine();
+    test_pose();
+    test_profile();
+    test_watchdog();
+    printf("%d failure(s)\n", failures);
+    return failures;
+}
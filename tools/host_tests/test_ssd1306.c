@@ -0,0 +1,76 @@
+/**
+ * @file    test_ssd1306.c
+ * @author  Jim Herd
+ * @brief   Host run of the SSD1306 driver, decoded by the emulator
+ *
+ * @note
+ * Runs the display driver through the I2C shim (ssd1306_shim.c) and
+ * prints the bus traffic of each frame for tools/ssd1306_emulator.py.
+ * The frames after "init" are the same as those of TEST mode 13, so the
+ * golden images in golden/ also check a capture taken on the robot :
+ *
+ *      make -C tools/host_tests ssd1306
+ *      python3 tools/ssd1306_emulator.py capture.txt --golden tools/host_tests/golden
+ *
+ * Exit status is the number of driver errors seen by the shim.
+ */
+
+#include <stdio.h>
+
+#include "system.h"
+#include "SSD1306.h"
+#include "OLED_128X64.h"
+
+extern uint32_t shim_errors;
+
+int main(void)
+{
+uint8_t     icon_string[3] = {BATTERY_HALF, GAMEPAD_CONNECTED, '\0'};
+
+// power up : probe, initialisation sequence and a clear display
+
+    printf("F,init\n");
+    SSD1306_init();
+
+// full screen : configuration and four rows of text
+
+    printf("F,text\n");
+    SSD1306_command_seq(init_sequence, init_sequence_length);
+    SSD1306_scroll_area_reset();
+    SSD1306_command(SET_DISPLAY_ON);
+    SSD1306_write_string(1, ICON_ROW, icon_string, false);
+    SSD1306_write_string(0, MESSAGE_ROW, (const uint8_t *)"  Emulator    ", false);
+    SSD1306_write_string(0, SCROLL_ROW_UPPER, (const uint8_t *)" Menu entry 1 ", true);
+    SSD1306_write_string(2, SCROLL_ROW_LOWER, (const uint8_t *)"Font 12x16", false);
+    SSD1306_mark_all_dirty();
+    SSD1306_flush();
+
+// a few changed characters
+
+    printf("F,cells\n");
+    SSD1306_write_cells(0, MESSAGE_ROW, 2, 3, (const uint8_t *)"EMU", false);
+    SSD1306_flush();
+
+// text at a pixel position that is not page aligned
+
+    printf("F,draw_text\n");
+    SSD1306_draw_text(FONT_6x8, 3, 21, (const uint8_t *)"draw_text y=21", 14, true);
+    SSD1306_flush();
+
+// graphics primitives
+
+    printf("F,graphics\n");
+    Oled_Line(0, 63, 127, 32, INVERSE);
+    Oled_Circle(100, 47, 12, INVERSE);
+    Oled_FillRectangle(4, 36, 20, 60, INVERSE);
+    SSD1306_flush();
+
+// scroll area moved up one row by start line : only new bottom row is sent
+
+    printf("F,scroll\n");
+    SSD1306_scroll_area_step();
+    SSD1306_write_string(0, SCROLL_ROW_LOWER, (const uint8_t *)" Menu entry 2 ", false);
+    SSD1306_flush();
+
+    return shim_errors;
+}
@@ -0,0 +1,297 @@
+#!/usr/bin/env python3
+"""
+@file    ssd1306_emulator.py
+@author  Jim Herd
+@brief   Host emulator of the SSD1306 I2C command/data stream
+
+Decodes display bus traffic captured by the firmware (TEST mode 13) and
+renders the display after each captured frame as a PBM image.  The
+emulator models the parts of the SSD1306 the driver uses :
+
+    control byte        Co and D/C# bits
+    addressing          horizontal, vertical and page modes, column and
+                        page address windows (0x21, 0x22), page mode
+                        page/column pointers (0xB0-0xB7, 0x00-0x1F)
+    display mapping     segment remap (0xA0/0xA1), COM scan direction
+                        (0xC0/0xC8), start line (0x40-0x7F) within the
+                        vertical scroll area (0xA3), display offset
+                        (0xD3), inverse (0xA6/0xA7), entire display on
+                        (0xA4/0xA5), display on/off (0xAE/0xAF)
+
+Other commands are parsed (with their parameter bytes) and ignored.
+Orientation of the image is that of the Robokid module : with 0xA1 and
+0xC8, column 0 of page 0 is the top left corner.
+
+Input is the serial output of TEST mode 13 (other lines are ignored) :
+
+    F,<frame name>
+    T,<control byte>,<length>       one per I2C transaction
+    D,<data bytes in hex>           transaction data (may be split)
+
+Usage (from repository root) :
+
+    python3 tools/ssd1306_emulator.py capture.txt
+    python3 tools/ssd1306_emulator.py capture.txt --out images --scale 4
+    python3 tools/ssd1306_emulator.py capture.txt --golden golden
+    python3 tools/ssd1306_emulator.py capture.txt --golden golden --update
+
+For each frame an image <out>/<frame>.pbm is written and a line of bus
+statistics is printed.  With --golden, each image is compared with
+<golden>/<frame>.pbm and the exit code is 1 if any differ; --update
+writes the golden images instead.
+
+tools/host_tests runs the driver on the host through an I2C shim and
+checks its output against tools/host_tests/golden.  The frames match
+those of TEST mode 13, so a capture from the robot can be checked
+against the same golden images.
+"""
+
+import argparse
+import os
+import sys
+
+WIDTH = 128
+HEIGHT = 64
+NOS_PAGES = HEIGHT // 8
+
+HORIZONTAL_MODE, VERTICAL_MODE, PAGE_MODE = 0, 1, 2
+
+#
+# Number of parameter bytes that follow each multi-byte command
+#
+COMMAND_PARAMETERS = {
+    0x20: 1,    # memory addressing mode
+    0x21: 2,    # column address
+    0x22: 2,    # page address
+    0x26: 6,    # right horizontal scroll
+    0x27: 6,    # left horizontal scroll
+    0x29: 5,    # vertical and right horizontal scroll
+    0x2A: 5,    # vertical and left horizontal scroll
+    0x81: 1,    # contrast
+    0x8D: 1,    # charge pump
+    0xA3: 2,    # vertical scroll area
+    0xA8: 1,    # multiplex ratio
+    0xD3: 1,    # display offset
+    0xD5: 1,    # display clock divide
+    0xD9: 1,    # pre-charge period
+    0xDA: 1,    # COM pins configuration
+    0xDB: 1,    # VCOMH deselect level
+}
+
+
+class SSD1306:
+    """State of display controller : GDDRAM, pointers and display mapping"""
+
+    def __init__(self):
+        self.ram = [[0] * WIDTH for _ in range(NOS_PAGES)]
+        self.mode = PAGE_MODE                   # reset values
+        self.column_start, self.column_end = 0, WIDTH - 1
+        self.page_start, self.page_end = 0, NOS_PAGES - 1
+        self.column, self.page = 0, 0
+        self.segment_remap = False
+        self.com_reverse = False
+        self.start_line = 0
+        self.fixed_rows = 0                     # vertical scroll area : rows above it
+        self.scroll_rows = HEIGHT               # and rows in it
+        self.offset = 0
+        self.inverse = False
+        self.entire_on = False
+        self.display_on = False
+        self.command = None                     # command waiting for parameters
+        self.parameters = []
+
+    # --- commands ---------------------------------------------------------
+
+    def write_command(self, byte):
+        if self.command is not None:
+            self.parameters.append(byte)
+            if len(self.parameters) == COMMAND_PARAMETERS[self.command]:
+                self.execute(self.command, self.parameters)
+                self.command = None
+            return
+        if byte in COMMAND_PARAMETERS:
+            self.command, self.parameters = byte, []
+            return
+        self.execute(byte, [])
+
+    def execute(self, command, parameters):
+        if command == 0x20:
+            self.mode = parameters[0] & 0x03
+        elif command == 0x21:
+            self.column_start = parameters[0] & 0x7F
+            self.column_end = parameters[1] & 0x7F
+            self.column = self.column_start
+        elif command == 0x22:
+            self.page_start = parameters[0] & 0x07
+            self.page_end = parameters[1] & 0x07
+            self.page = self.page_start
+        elif command == 0xA3:
+            self.fixed_rows = parameters[0] & 0x3F
+            self.scroll_rows = parameters[1] & 0x7F
+        elif command == 0xD3:
+            self.offset = parameters[0] & 0x3F
+        elif command <= 0x0F:                   # page mode : lower column nibble
+            self.column = (self.column & 0xF0) | command
+        elif command <= 0x1F:                   # page mode : upper column nibble
+            self.column = ((command & 0x07) << 4) | (self.column & 0x0F)
+        elif 0x40 <= command <= 0x7F:
+            self.start_line = command & 0x3F
+        elif command in (0xA0, 0xA1):
+            self.segment_remap = (command == 0xA1)
+        elif command in (0xA4, 0xA5):
+            self.entire_on = (command == 0xA5)
+        elif command in (0xA6, 0xA7):
+            self.inverse = (command == 0xA7)
+        elif command in (0xAE, 0xAF):
+            self.display_on = (command == 0xAF)
+        elif 0xB0 <= command <= 0xB7:
+            self.page = command & 0x07
+        elif command in (0xC0, 0xC8):
+            self.com_reverse = (command == 0xC8)
+
+    # --- data -------------------------------------------------------------
+
+    def write_data(self, byte):
+        self.ram[self.page][self.column] = byte
+        if self.mode == HORIZONTAL_MODE:
+            self.column += 1
+            if self.column > self.column_end:
+                self.column = self.column_start
+                self.page = self.page_start if self.page >= self.page_end else self.page + 1
+        elif self.mode == VERTICAL_MODE:
+            self.page += 1
+            if self.page > self.page_end:
+                self.page = self.page_start
+                self.column = self.column_start if self.column >= self.column_end else self.column + 1
+        else:
+            self.column = 0 if self.column >= (WIDTH - 1) else self.column + 1
+
+    # --- I2C transaction --------------------------------------------------
+
+    def transaction(self, data):
+        """One I2C write : control byte(s) and payload"""
+        index = 0
+        while index < len(data):
+            control = data[index]
+            index += 1
+            is_data = (control & 0x40) != 0
+            single = (control & 0x80) != 0      # Co : one byte, then another control byte
+            end = index + 1 if single else len(data)
+            for byte in data[index:end]:
+                if is_data:
+                    self.write_data(byte)
+                else:
+                    self.write_command(byte)
+            index = end
+
+    # --- output -----------------------------------------------------------
+
+    def pixel(self, x, y):
+        """Lit (1) or dark (0) at image position (x, y)"""
+        if not self.display_on:
+            return 0
+        if self.entire_on:
+            return 1
+        column = x if self.segment_remap else (WIDTH - 1 - x)
+        com = y if self.com_reverse else (HEIGHT - 1 - y)
+        row = com
+        if self.fixed_rows <= com < (self.fixed_rows + self.scroll_rows):
+            row = self.fixed_rows + ((com - self.fixed_rows + self.start_line) % self.scroll_rows)
+        row = (row + self.offset) % HEIGHT
+        value = (self.ram[row // 8][column] >> (row % 8)) & 1
+        return value ^ (1 if self.inverse else 0)
+
+    def image(self):
+        return [[self.pixel(x, y) for x in range(WIDTH)] for y in range(HEIGHT)]
+
+
+def read_capture(lines):
+    """List of (frame name, [transaction bytes]) from TEST mode 13 output"""
+    frames = []
+    for line in lines:
+        fields = line.strip().split(",")
+        if fields[0] == "F" and len(fields) == 2:
+            frames.append((fields[1], []))
+        elif not frames:
+            continue
+        elif fields[0] == "T" and len(fields) == 3:
+            frames[-1][1].append(bytearray([int(fields[1], 16)]))
+        elif fields[0] == "D" and len(fields) == 2 and frames[-1][1]:
+            frames[-1][1][-1].extend(bytes.fromhex(fields[1]))
+        elif fields[0] == "X":
+            sys.stderr.write("warning : frame %s incomplete (%s)\n" % (frames[-1][0], fields[1]))
+    return frames
+
+
+def write_pbm(path, image, scale):
+    """Plain PBM : lit pixels are black"""
+    with open(path, "w") as out:
+        out.write("P1\n%d %d\n" % (WIDTH * scale, HEIGHT * scale))
+        for row in image:
+            line = " ".join(str(value) for value in row for _ in range(scale))
+            for _ in range(scale):
+                out.write(line + "\n")
+
+
+def read_pbm(path):
+    """Image from a plain PBM written by write_pbm (any scale)"""
+    tokens = []
+    for line in open(path):
+        tokens.extend(line.split("#")[0].split())
+    width, height = int(tokens[1]), int(tokens[2])
+    values = [int(value) for value in tokens[3:]]
+    scale = width // WIDTH
+    return [[values[(y * scale * width) + (x * scale)] for x in range(WIDTH)] for y in range(HEIGHT)] \
+        if (scale > 0) and (height == HEIGHT * scale) else None
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Render SSD1306 bus capture to PBM images")
+    parser.add_argument("capture", help="serial output of TEST mode 13")
+    parser.add_argument("--out", default=".", help="directory for images")
+    parser.add_argument("--scale", type=int, default=1, help="pixels per display pixel")
+    parser.add_argument("--baud", type=int, default=400000, help="I2C bits/sec for bus time")
+    parser.add_argument("--golden", help="directory of reference images")
+    parser.add_argument("--update", action="store_true", help="write reference images")
+    args = parser.parse_args()
+
+    frames = read_capture(open(args.capture))
+    if not frames:
+        sys.exit("no frames in %s" % args.capture)
+    os.makedirs(args.out, exist_ok=True)
+    if args.golden:
+        os.makedirs(args.golden, exist_ok=True)
+
+    display = SSD1306()
+    failures = 0
+    print("Frame,Transactions,Bytes,Bus uS")
+    for name, transactions in frames:
+        for data in transactions:
+            display.transaction(data)
+        nos_bytes = sum(len(data) + 1 for data in transactions)    # + I2C address byte
+        print("%s,%d,%d,%d" % (name, len(transactions), nos_bytes, (nos_bytes * 9 * 1000000) // args.baud))
+
+        image = display.image()
+        write_pbm(os.path.join(args.out, name + ".pbm"), image, args.scale)
+        if args.golden:
+            golden_path = os.path.join(args.golden, name + ".pbm")
+            if args.update:
+                write_pbm(golden_path, image, 1)
+            elif not os.path.exists(golden_path):
+                print("%s : no golden image" % name)
+                failures += 1
+            else:
+                golden = read_pbm(golden_path)
+                if golden is None:
+                    print("%s : golden image is not %dx%d" % (name, WIDTH, HEIGHT))
+                    failures += 1
+                    continue
+                errors = sum(golden[y][x] != image[y][x] for y in range(HEIGHT) for x in range(WIDTH))
+                if errors:
+                    print("%s : %d pixels differ from golden image" % (name, errors))
+                    failures += 1
+    sys.exit(1 if failures else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,192 @@
+#!/usr/bin/env python3
+"""
+@file    telemetry_decoder.py
+@author  Jim Herd
+@brief   Decode binary telemetry frames from the Robokid serial output
+
+Robokid TEST modes 1 and 2 stream telemetry records as COBS encoded
+frames, each followed by a 0x00 delimiter (see src/telemetry.c).  A frame
+holds :
+
+    record type         1 byte
+    sequence number     1 byte, incremented for each frame sent
+    time                4 bytes, uS (time_us_32, wraps after ~71 minutes)
+    payload             depends on record type
+    CRC                 2 bytes, CRC-16/CCITT (0x1021, initial 0xFFFF)
+                        of all preceding bytes
+
+Multi-byte values are little endian.  Frames with a bad CRC, wrong
+length or unknown type are counted and dropped; gaps in the sequence
+number are counted as lost frames.
+
+Input is a raw capture of the serial port, or the port itself (needs
+pyserial) :
+
+    python3 tools/telemetry_decoder.py capture.bin
+    python3 tools/telemetry_decoder.py capture.bin --out logs
+    python3 tools/telemetry_decoder.py /dev/ttyUSB0 --serial --baud 115200
+
+One CSV file per record type is written to <out> (analogue.csv,
+analogue_channel.csv, motor.csv, task.csv), with a header row.  Time is
+extended past the 32-bit wrap so that it always increases.
+"""
+
+import argparse
+import csv
+import os
+import struct
+import sys
+
+HEADER = struct.Struct("<BBI")
+CRC_SIZE = 2
+
+#
+# Record type : (file name, payload layout, column names)
+#
+RECORDS = {
+    1: ("analogue", struct.Struct("<8H"),
+        ["POT A", "POT B", "Spare", "Vm", "IR Left", "IR Mid", "IR Right", "POT C"]),
+    2: ("analogue_channel", struct.Struct("<BHHHBH"),
+        ["Channel", "Raw", "Filter", "G_thresh", "G_count", "Max_delta"]),
+    3: ("motor", struct.Struct("<BbBbII"),
+        ["Left state", "Left PWM", "Right state", "Right PWM", "Commands", "Expired"]),
+    4: ("task", struct.Struct("<BIIII"),
+        ["Task", "Stack high water", "Last exec uS", "Lowest exec uS", "Highest exec uS"]),
+}
+
+
+def crc16(data):
+    """CRC-16/CCITT-FALSE, as in the firmware"""
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def cobs_decode(data):
+    """Decoded bytes of one frame (without delimiter), or None if malformed"""
+    out = bytearray()
+    index = 0
+    while index < len(data):
+        code = data[index]
+        if code == 0 or (index + code) > len(data):
+            return None
+        out.extend(data[index + 1:index + code])
+        index += code
+        if code < 0xFF and index < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def read_frames(stream, live=False):
+    """Yield the bytes between 0x00 delimiters
+
+    An empty read is the end of a file.  A live serial port returns an
+    empty read when the line is quiet, so it is read until Ctrl-C.
+    """
+    pending = bytearray()
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            if live:
+                continue
+            break
+        pending.extend(chunk)
+        while True:
+            end = pending.find(b"\x00")
+            if end < 0:
+                break
+            yield bytes(pending[:end])
+            del pending[:end + 1]
+
+
+class Decoder:
+    """Check and unpack frames, writing records to CSV files"""
+
+    def __init__(self, out):
+        self.out = out
+        self.files = {}
+        self.writers = {}
+        self.counts = {record_type: 0 for record_type in RECORDS}
+        self.bad_frames = 0
+        self.lost_frames = 0
+        self.sequence = None
+        self.last_time = None
+        self.time_base = 0
+
+    def writer(self, record_type):
+        if record_type not in self.writers:
+            name, _, columns = RECORDS[record_type]
+            self.files[record_type] = open(os.path.join(self.out, name + ".csv"), "w", newline="")
+            self.writers[record_type] = csv.writer(self.files[record_type])
+            self.writers[record_type].writerow(["Sequence", "Time uS"] + columns)
+        return self.writers[record_type]
+
+    def frame(self, encoded):
+        if not encoded:
+            return
+        frame = cobs_decode(encoded)
+        if (frame is None) or (len(frame) < HEADER.size + CRC_SIZE):
+            self.bad_frames += 1
+            return
+        body, crc = frame[:-CRC_SIZE], struct.unpack("<H", frame[-CRC_SIZE:])[0]
+        if crc16(body) != crc:
+            self.bad_frames += 1
+            return
+        record_type, sequence, time_us = HEADER.unpack_from(body)
+        if (record_type not in RECORDS) or (len(body) != HEADER.size + RECORDS[record_type][1].size):
+            self.bad_frames += 1
+            return
+
+        if self.sequence is not None:
+            self.lost_frames += (sequence - self.sequence - 1) & 0xFF
+        self.sequence = sequence
+        if (self.last_time is not None) and (time_us < self.last_time):
+            self.time_base += 1 << 32
+        self.last_time = time_us
+
+        values = RECORDS[record_type][1].unpack_from(body, HEADER.size)
+        self.writer(record_type).writerow([sequence, self.time_base + time_us] + list(values))
+        self.counts[record_type] += 1
+
+    def close(self):
+        for file in self.files.values():
+            file.close()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode Robokid binary telemetry to CSV files")
+    parser.add_argument("input", help="raw capture file, or serial port with --serial")
+    parser.add_argument("--out", default=".", help="directory for CSV files")
+    parser.add_argument("--serial", action="store_true", help="read from serial port (Ctrl-C to stop)")
+    parser.add_argument("--baud", type=int, default=115200, help="serial port baud rate")
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    if args.serial:
+        import serial
+        stream = serial.Serial(args.input, args.baud, timeout=1)
+    else:
+        stream = open(args.input, "rb")
+
+    decoder = Decoder(args.out)
+    try:
+        for encoded in read_frames(stream, live=args.serial):
+            decoder.frame(encoded)
+    except KeyboardInterrupt:
+        pass
+    decoder.close()
+
+    print("Record,Count")
+    for record_type, (name, _, _) in RECORDS.items():
+        print("%s,%d" % (name, decoder.counts[record_type]))
+    print("Bad frames,%d" % decoder.bad_frames)
+    print("Lost frames,%d" % decoder.lost_frames)
+    sys.exit(1 if decoder.bad_frames else 0)
+
+
+if __name__ == "__main__":
+    main()